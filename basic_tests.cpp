@@ -14,6 +14,14 @@
 #include "colors.h"
 #include <string>
 #include <vector>
+#include <thread>
+#include <atomic>
+#include <map>
+#include <memory_resource>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <cstring>
 
 // Test class for Memento
 class GameCharacter: public Memento {
@@ -210,6 +218,309 @@ void testComplexObjects() {
 	std::cout << GRN << "Objects properly destroyed and returned to pool" << RESET << std::endl;
 }
 
+void testGrowablePool() {
+	std::cout << YEL << "\n=== Testing segmented Pool growth ===" << RESET << std::endl;
+
+	Pool<int> pool;
+	pool.resize(2);
+	pool.setGrowth(4, 8);
+
+	std::vector<Pool<int>::Object> objects;
+	objects.push_back(pool.acquire(0));
+	int *firstAddress = &*objects.front();
+
+	for (int i = 1; i < 8; ++i) {
+		objects.push_back(pool.acquire(i));
+	}
+	std::cout << "Capacity after growth: " << pool.getCapacity() << " in " << pool.getSlabCount() << " slabs" << std::endl;
+	std::cout << "First object kept its address: " << (firstAddress == &*objects.front() ? "true" : "false") << std::endl;
+
+	auto none = pool.tryAcquire(99);
+	std::cout << "tryAcquire at the hard cap returns empty: " << (none.has_value() ? "false" : "true") << std::endl;
+
+	try {
+		pool.acquire(99);
+	} catch (const std::runtime_error &e) {
+		std::cout << GRN << "✓ Correctly caught exception: " << e.what() << RESET << std::endl;
+	}
+
+	objects.pop_back();
+	auto reused = pool.tryAcquire(100);
+	std::cout << GRN << "✓ Released slot reused by tryAcquire: " << **reused << RESET << std::endl;
+
+	// Resizing to the current capacity is not a shrink, even with objects in use
+	pool.resize(pool.getCapacity());
+	std::cout << "resize(capacity) with live objects kept capacity: " << pool.getCapacity() << std::endl;
+	try {
+		pool.resize(2);
+	} catch (const std::runtime_error &e) {
+		std::cout << GRN << "✓ Correctly caught exception: " << e.what() << RESET << std::endl;
+	}
+}
+
+void testConcurrentPool() {
+	std::cout << YEL << "\n=== Testing lock-free ConcurrentPool across threads ===" << RESET << std::endl;
+
+	const size_t CAPACITY = 64;
+	const int NUM_THREADS = 8;
+	const int ITERATIONS = 20000;
+
+	ConcurrentPool<size_t> pool(CAPACITY);
+	std::atomic<size_t> corrupted(0);
+	std::vector<std::thread> threads;
+
+	for (int t = 0; t < NUM_THREADS; ++t) {
+		threads.emplace_back([&pool, &corrupted, t]() {
+			// Half of the threads use a magazine cache
+			std::optional<ConcurrentPool<size_t>::ThreadCache> cache;
+			if (t % 2 == 0) {
+				cache.emplace(pool);
+			}
+
+			for (int i = 0; i < ITERATIONS; ++i) {
+				size_t stamp = static_cast<size_t>(t) * ITERATIONS + i;
+				auto first = pool.tryAcquire(stamp);
+				auto second = pool.tryAcquire(stamp + 1);
+				if ((first && **first != stamp) || (second && **second != stamp + 1)) {
+					corrupted++;
+				}
+			}
+		});
+	}
+	for (auto &thread : threads) {
+		thread.join();
+	}
+
+	std::vector<ConcurrentPool<size_t>::Object> drained;
+	while (auto obj = pool.tryAcquire(0)) {
+		drained.push_back(std::move(*obj));
+	}
+
+	std::cout << "Corrupted objects: " << corrupted.load() << ", slots recovered: " << drained.size() << "/" << CAPACITY << std::endl;
+	if (corrupted == 0 && drained.size() == CAPACITY) {
+		std::cout << GRN << "✓ Every slot returned to the shared free list" << RESET << std::endl;
+	} else {
+		std::cout << RED << "ConcurrentPool lost or shared slots" << RESET << std::endl;
+	}
+}
+
+void testAlignedPool() {
+	std::cout << YEL << "\n=== Testing Pool slot alignment ===" << RESET << std::endl;
+
+	struct alignas(32) SimdVector { float lanes[8]; };
+	struct Counter { long hits; };
+
+	Pool<SimdVector> simdPool;
+	simdPool.resize(4);
+	bool aligned = true;
+	std::vector<Pool<SimdVector>::Object> vectors;
+	for (int i = 0; i < 4; ++i) {
+		vectors.push_back(simdPool.acquire());
+		aligned = aligned && reinterpret_cast<uintptr_t>(&*vectors.back()) % alignof(SimdVector) == 0;
+	}
+	std::cout << "Over-aligned objects respect alignof(" << alignof(SimdVector) << "): " << (aligned ? "true" : "false") << std::endl;
+
+	Pool<Counter, cacheLineSize> counterPool;
+	counterPool.resize(2);
+	auto first = counterPool.acquire(Counter{0});
+	auto second = counterPool.acquire(Counter{0});
+	uintptr_t a = reinterpret_cast<uintptr_t>(&*first);
+	uintptr_t b = reinterpret_cast<uintptr_t>(&*second);
+	size_t distance = a > b ? a - b : b - a;
+	std::cout << "Cache-line padded slots are " << distance << " bytes apart, line aligned: "
+		<< (a % cacheLineSize == 0 && b % cacheLineSize == 0 ? "true" : "false") << std::endl;
+
+	ConcurrentPool<Counter, cacheLineSize> shared(2);
+	auto counter = shared.acquire(Counter{0});
+	std::cout << GRN << "✓ ConcurrentPool slot line aligned: "
+		<< (reinterpret_cast<uintptr_t>(&*counter) % cacheLineSize == 0 ? "true" : "false") << RESET << std::endl;
+}
+
+void testSlotMap() {
+	std::cout << YEL << "\n=== Testing generational SlotMap handles ===" << RESET << std::endl;
+
+	struct Particle { float x, y; int id; };
+	SlotMap<Particle> particles;
+	std::vector<SlotMap<Particle>::Handle> handles;
+
+	for (int i = 0; i < 5; ++i) {
+		handles.push_back(particles.acquire(Particle{0.0f, 0.0f, i}));
+	}
+	std::cout << "Handle size: " << sizeof(SlotMap<Particle>::Handle) << " bytes, live particles: " << particles.size() << std::endl;
+
+	particles.release(handles[1]);
+	std::cout << "Released handle detected as stale: " << (particles.get(handles[1]) == nullptr ? "true" : "false") << std::endl;
+
+	auto reused = particles.acquire(Particle{1.0f, 1.0f, 42});
+	std::cout << "Reused slot gets a new generation: " << (reused != handles[1] && !particles.contains(handles[1]) ? "true" : "false") << std::endl;
+
+	int sum = 0;
+	for (const Particle &particle : particles) {
+		sum += particle.id;
+	}
+	std::cout << "Dense iteration over " << particles.size() << " live particles, id sum: " << sum << std::endl;
+	std::cout << "Handle 4 still resolves after compaction: " << particles.at(handles[4]).id << std::endl;
+
+	try {
+		particles.at(handles[1]);
+	} catch (const std::out_of_range &e) {
+		std::cout << GRN << "✓ Correctly caught exception: " << e.what() << RESET << std::endl;
+	}
+
+	// 12 generation bits: cycle one slot until its generations run out
+	SlotMap<int> cycled;
+	std::vector<SlotMap<int>::Handle> old;
+	bool staleRejected = true;
+	for (int i = 0; i < 5000; ++i) {
+		old.push_back(cycled.acquire(i));
+		cycled.release(old.back());
+		staleRejected = staleRejected && !cycled.contains(old.front()) && cycled.get(old.front()) == nullptr;
+	}
+	for (const auto &handle : old) {
+		staleRejected = staleRejected && !cycled.contains(handle);
+	}
+	std::cout << GRN << "✓ Handles stay stale past the generation wrap: " << (staleRejected ? "true" : "false")
+		<< ", retired slot not reused: " << ((old.back().raw() & 0xFFFFF) != 0 ? "true" : "false") << RESET << std::endl;
+}
+
+void testPoolStats() {
+	std::cout << YEL << "\n=== Testing Pool instrumentation ===" << RESET << std::endl;
+
+	struct Request { int id; };
+	Pool<Request, alignof(Request), PoolLatencyStats> requests;
+	requests.resize(2);
+	requests.setGrowth(2, 4);
+
+	{
+		std::vector<Pool<Request, alignof(Request), PoolLatencyStats>::Object> burst;
+		for (int i = 0; i < 4; ++i) {
+			burst.push_back(requests.acquire(Request{i}));
+		}
+		if (!requests.tryAcquire(Request{4})) {
+			std::cout << "Burst of 5 requests exhausted a pool capped at " << requests.getCapacity() << std::endl;
+		}
+		burst.pop_back();
+	}
+	auto late = requests.acquire(Request{5});
+
+	PoolStatsSnapshot stats = requests.getStats();
+	uint64_t timed = 0;
+	for (uint64_t bucket : stats.acquireLatency) {
+		timed += bucket;
+	}
+	std::cout << "live: " << stats.live << ", high-water mark: " << stats.highWaterMark
+		<< ", acquires: " << stats.acquires << ", releases: " << stats.releases << std::endl;
+	std::cout << "exhaustions: " << stats.exhaustions << ", growths: " << stats.growths
+		<< ", timed acquires: " << timed << std::endl;
+
+	Pool<Request> plain;
+	plain.resize(1);
+	auto only = plain.acquire(Request{0});
+	PoolStatsSnapshot none = plain.getStats();
+	if (none.live == 1 && none.acquires == 0) {
+		std::cout << GRN << "✓ Pools without a stats policy only report occupancy" << RESET << std::endl;
+	} else {
+		std::cout << RED << "Default pool recorded counters" << RESET << std::endl;
+	}
+}
+
+void testRecyclingPool() {
+	std::cout << YEL << "\n=== Testing Pool recycling and batches ===" << RESET << std::endl;
+
+	struct Packet { std::vector<char> payload; };
+	Pool<Packet> packets;
+	packets.resize(8);
+	packets.setRecycler([](Packet &packet) { packet.payload.clear(); });
+
+	const char *bufferAddress = nullptr;
+	{
+		auto packet = packets.acquire();
+		packet->payload.resize(4096);
+		bufferAddress = packet->payload.data();
+	}
+	auto reused = packets.acquire();
+	std::cout << "Recycled packet is empty: " << (reused->payload.empty() ? "true" : "false")
+		<< ", kept capacity: " << reused->payload.capacity()
+		<< ", same buffer: " << (reused->payload.data() == bufferAddress ? "true" : "false") << std::endl;
+
+	std::vector<Pool<Packet>::Object> batch = packets.acquireBatch(5);
+	std::cout << "Batch of " << batch.size() << " acquired, available: " << packets.getAvailable() << std::endl;
+	packets.releaseBatch(batch);
+	std::cout << "Batch released, available: " << packets.getAvailable()
+		<< ", recycled: " << packets.getRecycled() << std::endl;
+
+	try {
+		auto tooMany = packets.acquireBatch(9);
+	} catch (const std::runtime_error &e) {
+		std::cout << GRN << "✓ Correctly caught exception: " << e.what()
+			<< " (available still " << packets.getAvailable() << ")" << RESET << std::endl;
+	}
+
+	packets.setRecycler(nullptr);
+	std::cout << "Recycling disabled, recycled objects destroyed: " << (packets.getRecycled() == 0 ? "true" : "false") << std::endl;
+
+	try {
+		Pool<Packet> stolen(std::move(packets));
+	} catch (const std::runtime_error &e) {
+		std::cout << GRN << "✓ Correctly caught exception: " << e.what() << RESET << std::endl;
+	}
+	Pool<int> source;
+	source.resize(4);
+	Pool<int> target(std::move(source));
+	{
+		auto value = target.acquire(5);
+	}
+	std::cout << "Moved pool capacity: " << target.getCapacity() << ", source left with " << source.getCapacity() << std::endl;
+}
+
+void testMemoryResources() {
+	std::cout << YEL << "\n=== Testing pmr resources over Pool and an arena ===" << RESET << std::endl;
+
+	PoolResource<64> nodes(16);
+	{
+		std::pmr::map<int, int> scores(&nodes);
+		for (int i = 0; i < 8; ++i) {
+			scores[i] = i * 10;
+		}
+		std::cout << "Map nodes from the pool: " << nodes.getCapacity() - nodes.getAvailable()
+			<< " blocks in use for " << scores.size() << " entries" << std::endl;
+	}
+	std::cout << "Blocks returned after the map is gone: " << (nodes.getAvailable() == nodes.getCapacity() ? "true" : "false") << std::endl;
+
+	ArenaResource frame(1024);
+	for (int frameIndex = 0; frameIndex < 3; ++frameIndex) {
+		std::pmr::vector<int> visible(&frame);
+		for (int i = 0; i < 100; ++i) {
+			visible.push_back(i);
+		}
+		frame.reset();
+	}
+	std::cout << "Arena reused across frames: " << frame.getChunkCount() << " chunk(s), "
+		<< frame.getCapacity() << " bytes held" << std::endl;
+
+	ArenaResource events(1024);
+	Observer<int> observer(&events);
+	int fired = 0;
+	observer.subscribe(1, [&fired]() { fired++; });
+	observer.subscribe(1, [&fired]() { fired++; });
+	observer.notify(1);
+	if (fired == 2 && events.getUsed() > 0) {
+		std::cout << GRN << "✓ Observer subscriptions allocated from the arena" << RESET << std::endl;
+	} else {
+		std::cout << RED << "Observer did not use the given resource" << RESET << std::endl;
+	}
+
+	PoolResource<16> tiny(1);
+	try {
+		void *first = tiny.allocate(16);
+		void *second = tiny.allocate(16);
+		tiny.deallocate(second, 16);
+		tiny.deallocate(first, 16);
+	} catch (const std::bad_alloc &e) {
+		std::cout << GRN << "✓ Correctly caught exception: " << e.what() << RESET << std::endl;
+	}
+}
+
 void testBasicDataBuffer() {
 	std::cout << YEL << "\n=== Testing Basic DataBuffer management ===" << RESET << std::endl;
 
@@ -298,6 +609,284 @@ void testMultiDataBuffer() {
 	}
 }
 
+void testArenaDataBuffer() {
+	std::cout << YEL << "\n=== Testing DataBuffer arena storage with many mixed records ===" << RESET << std::endl;
+
+	DataBuffer buffer;
+	buffer.reserve(1024, 64);
+
+	for (int i = 0; i < 50; ++i) {
+		if (i % 2 == 0) {
+			buffer << i;
+		} else {
+			buffer << static_cast<double>(i) * 0.5;
+		}
+	}
+	std::cout << "Stored " << buffer.size() << " records in " << buffer.byteSize() << " arena bytes" << std::endl;
+
+	DataBuffer copy = buffer;
+	bool ok = true;
+	for (int i = 0; i < 50; ++i) {
+		if (i % 2 == 0) {
+			int value;
+			copy >> value;
+			ok = ok && value == i;
+		} else {
+			double value;
+			copy >> value;
+			ok = ok && value == static_cast<double>(i) * 0.5;
+		}
+	}
+
+	if (ok) {
+		std::cout << GRN << "Copied arena restored all 50 values" << RESET << std::endl;
+	} else {
+		std::cout << RED << "Arena data mismatch" << RESET << std::endl;
+	}
+
+	buffer.clear();
+	std::cout << "After clear(): " << buffer.size() << " records, " << buffer.byteSize() << " bytes" << std::endl;
+}
+
+void testDataBufferViews() {
+	std::cout << YEL << "\n=== Testing zero-copy DataBuffer views ===" << RESET << std::endl;
+
+	DataBuffer buffer;
+	std::vector<unsigned char> blob(4096, 0xAB);
+	buffer << 7 << std::string_view("large payload name");
+	buffer.writeBytes(blob.data(), blob.size());
+
+	DataBufferView reader = buffer.view();
+	int id;
+	std::string_view name;
+	ByteSpan bytes;
+	reader >> id >> name >> bytes;
+
+	std::cout << "id: " << id << ", name: '" << name << "', blob: " << bytes.size() << " bytes" << std::endl;
+	if (bytes.size() == blob.size() && std::memcmp(bytes.data(), blob.data(), blob.size()) == 0) {
+		std::cout << GRN << "Blob viewed in place without copying" << RESET << std::endl;
+	} else {
+		std::cout << RED << "Blob view mismatch" << RESET << std::endl;
+	}
+
+	// The view has its own cursor, the buffer can still be read from the start
+	int sameId;
+	buffer >> sameId;
+	std::cout << "Buffer cursor independent from view: " << (sameId == id ? "true" : "false") << std::endl;
+
+	try {
+		DataBufferView wrong = buffer.view();
+		double notThere;
+		wrong >> notThere;
+	} catch (const std::exception &e) {
+		std::cout << GRN << "Correctly caught exception: " << e.what() << RESET << std::endl;
+	}
+}
+
+void testSharedDataBuffer() {
+	std::cout << YEL << "\n=== Testing copy-on-write and move of DataBuffer ===" << RESET << std::endl;
+
+	DataBuffer original;
+	original << 1 << 2 << 3;
+
+	DataBuffer copy = original;
+	std::cout << "Copy shares storage: " << (copy.isShared() ? "true" : "false") << std::endl;
+
+	copy << 4;
+	std::cout << "After writing to the copy - shared: " << (copy.isShared() ? "true" : "false")
+		<< ", original records: " << original.size() << ", copy records: " << copy.size() << std::endl;
+
+	DataBuffer moved = std::move(copy);
+	std::cout << "Moved buffer records: " << moved.size() << ", moved-from records: " << copy.size() << std::endl;
+
+	int a, b, c, d;
+	moved >> a >> b >> c >> d;
+	if (original.size() == 3 && a == 1 && b == 2 && c == 3 && d == 4) {
+		std::cout << GRN << "Copy-on-write kept both buffers consistent" << RESET << std::endl;
+	} else {
+		std::cout << RED << "Copy-on-write mismatch" << RESET << std::endl;
+	}
+}
+
+void testBulkDataBuffer() {
+	std::cout << YEL << "\n=== Testing bulk and variable-length DataBuffer records ===" << RESET << std::endl;
+
+	std::vector<float> samples(100000);
+	for (size_t i = 0; i < samples.size(); ++i) {
+		samples[i] = static_cast<float>(i) * 0.25f;
+	}
+
+	DataBuffer inner;
+	inner << 99 << std::string("inner");
+
+	DataBuffer buffer;
+	buffer << samples << std::string("owned string") << "literal" << inner;
+	std::cout << samples.size() << " floats stored in " << buffer.size() << " records" << std::endl;
+
+	std::vector<float> restoredSamples;
+	std::string owned;
+	std::string_view literal;
+	DataBuffer restoredInner;
+	buffer >> restoredSamples >> owned >> literal >> restoredInner;
+
+	int innerValue;
+	std::string innerName;
+	restoredInner >> innerValue >> innerName;
+
+	std::cout << "Strings: '" << owned << "', '" << literal << "', nested: " << innerValue << " '" << innerName << "'" << std::endl;
+	if (restoredSamples == samples) {
+		std::cout << GRN << "Bulk array restored in one record" << RESET << std::endl;
+	} else {
+		std::cout << RED << "Bulk array mismatch" << RESET << std::endl;
+	}
+
+	DataBufferView reader = buffer.view();
+	reader.rewind();
+	DataBufferView nested;
+	float firstFour[4];
+	std::string_view ignored;
+	try {
+		reader.readArray(firstFour, 4);
+	} catch (const std::length_error &e) {
+		std::cout << GRN << "Correctly caught exception: " << e.what() << RESET << std::endl;
+	}
+	reader.rewind();
+	reader.readBytes();
+	reader >> ignored >> ignored >> nested;
+	std::cout << "Nested view holds " << nested.size() << " records without copying" << std::endl;
+}
+
+void testPersistentDataBuffer() {
+	std::cout << YEL << "\n=== Testing DataBuffer snapshot files ===" << RESET << std::endl;
+
+	const std::string path = "/tmp/libftpp_snapshot_test.bin";
+	struct Point { int x, y; };
+
+	DataBuffer buffer;
+	buffer << 42 << Point{3, 4} << std::string("persisted") << std::vector<double>{1.5, 2.5, 3.5};
+	buffer.saveToFile(path);
+
+	DataBuffer mapped = DataBuffer::mapFile(path);
+	int answer;
+	Point point;
+	std::string_view text;
+	std::vector<double> values;
+	mapped >> answer >> point >> text >> values;
+
+	std::cout << "Mapped: " << (mapped.isMapped() ? "true" : "false") << ", answer: " << answer
+		<< ", point: (" << point.x << ", " << point.y << "), text: '" << text << "', values: " << values.size() << std::endl;
+
+	DataBuffer loaded = DataBuffer::loadFile(path);
+	loaded << 7;
+	std::cout << "Loaded copy records: " << loaded.size() << ", mapped records: " << mapped.size() << std::endl;
+
+	mapped << 1;
+	std::cout << "Writing to a mapped buffer copies it: mapped = " << (mapped.isMapped() ? "true" : "false") << std::endl;
+
+	try {
+		DataBuffer::mapFile("/tmp/libftpp_missing_snapshot.bin");
+	} catch (const std::runtime_error &e) {
+		std::cout << GRN << "Correctly caught exception: " << e.what() << RESET << std::endl;
+	}
+
+	// A nested buffer whose header claims more records than its record holds
+	DataBuffer inner;
+	inner << 1 << 2;
+	DataBuffer outer;
+	outer << inner;
+	outer.saveToFile(path);
+	{
+		std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+		DataBufferFileHeader header;
+		DataBufferRecord record;
+		file.read(reinterpret_cast<char*>(&header), sizeof(header));
+		file.seekg(header.indexOffset);
+		file.read(reinterpret_cast<char*>(&record), sizeof(record));
+		DataBufferNestedHeader corrupted = {1000000, 1u << 24};
+		file.seekp(header.arenaOffset + record.offset);
+		file.write(reinterpret_cast<const char*>(&corrupted), sizeof(corrupted));
+	}
+	try {
+		DataBuffer::mapFile(path);
+		std::cout << RED << "Corrupted nested header was accepted" << RESET << std::endl;
+	} catch (const std::runtime_error &e) {
+		std::cout << GRN << "Correctly caught exception: " << e.what() << RESET << std::endl;
+	}
+
+	// Same buffer cut in half
+	outer.saveToFile(path);
+	std::string bytes;
+	{
+		std::ifstream file(path, std::ios::binary);
+		bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	}
+	{
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		file.write(bytes.data(), bytes.size() / 2);
+	}
+	try {
+		DataBuffer::loadFile(path);
+		std::cout << RED << "Truncated snapshot was accepted" << RESET << std::endl;
+	} catch (const std::runtime_error &e) {
+		std::cout << GRN << "Correctly caught exception: " << e.what() << RESET << std::endl;
+	}
+
+	// Header whose index offset wraps the size arithmetic around
+	{
+		DataBufferFileHeader header;
+		std::memcpy(&header, bytes.data(), sizeof(header));
+		header.indexOffset = std::numeric_limits<uint64_t>::max() - 63;
+		header.arenaOffset = 64;
+		header.recordCount = 4;
+		std::memcpy(&bytes[0], &header, sizeof(header));
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		file.write(bytes.data(), bytes.size());
+	}
+	try {
+		DataBuffer::mapFile(path);
+		std::cout << RED << "Corrupted snapshot header was accepted" << RESET << std::endl;
+	} catch (const std::runtime_error &e) {
+		std::cout << GRN << "Correctly caught exception: " << e.what() << RESET << std::endl;
+	}
+	std::remove(path.c_str());
+}
+
+void testUncheckedDataBuffer() {
+	std::cout << YEL << "\n=== Testing DataBuffer read policies ===" << RESET << std::endl;
+
+	BasicDataBuffer<DataBufferUnchecked> fast;
+	fast << 'a' << 12345 << 2.5 << std::string("schema known statically") << std::vector<int>{1, 2, 3};
+
+	char c;
+	int number;
+	double real;
+	std::string text;
+	std::vector<int> values;
+	fast >> c >> number >> real >> text >> values;
+
+	std::cout << "Unchecked buffer keeps " << fast.size() << " index records for " << fast.byteSize() << " bytes" << std::endl;
+	std::cout << "Read back: " << c << ", " << number << ", " << real << ", '" << text << "', " << values.size() << " ints" << std::endl;
+
+	const std::string path = "/tmp/libftpp_unchecked_test.bin";
+	fast.saveToFile(path);
+	auto mapped = BasicDataBuffer<DataBufferUnchecked>::mapFile(path);
+	mapped >> c >> number;
+	std::cout << "Mapped unchecked snapshot: " << c << ", " << number << std::endl;
+
+	try {
+		DataBuffer::mapFile(path);
+	} catch (const std::runtime_error &e) {
+		std::cout << GRN << "Correctly caught exception: " << e.what() << RESET << std::endl;
+	}
+	std::remove(path.c_str());
+
+	BasicDataBuffer<DataBufferDebugChecked> debug;
+	debug << 1.0f;
+	float f;
+	debug >> f;
+	std::cout << "Debug-checked policy is " << (DataBufferDebugChecked::checked ? "checked" : "unchecked") << " in this build" << std::endl;
+}
+
 void testMemento() {
 	std::cout << MAG << "\n=== Testing MEMENTO pattern with GameCharacter inheriting class ===" << RESET << std::endl;
 
@@ -314,6 +903,25 @@ void testMemento() {
 	// State restoring
 	player.load(checkpoint);
 	std::cout << "After state restoring: Health=" << player.getHealth() << ", Level=" << player.getLevel() << std::endl;
+
+	// Undo history: storing and reloading snapshots never duplicates their bytes
+	std::vector<Memento::Snapshot> history;
+	history.push_back(player.save());
+	player.takeDamage(10);
+	history.push_back(player.save());
+	player.takeDamage(10);
+
+	player.load(history.front());
+	player.load(history.front());
+	std::cout << "After loading the oldest undo entry twice: Health=" << player.getHealth() << ", Level=" << player.getLevel() << std::endl;
+
+	// Persisted snapshots are restored straight from the mapped file
+	const std::string path = "/tmp/libftpp_memento_test.bin";
+	history.front().saveToFile(path);
+	player.takeDamage(30);
+	player.load(DataBuffer::mapFile(path));
+	std::cout << "After loading the snapshot file: Health=" << player.getHealth() << ", Level=" << player.getLevel() << std::endl;
+	std::remove(path.c_str());
 }
 
 void testObserver() {
@@ -535,11 +1143,24 @@ int main(void) {
 	testMoveSemantics();
 	testVariadicTemplates();
 	testComplexObjects();
+	testGrowablePool();
+	testConcurrentPool();
+	testAlignedPool();
+	testSlotMap();
+	testPoolStats();
+	testRecyclingPool();
+	testMemoryResources();
 
 	std::cout << CYN << "\n====== DATABUFFER data structure tests ======" << RESET << std::endl;
 	testBasicDataBuffer();
 	testAdvancedDataBuffer();
 	testMultiDataBuffer();
+	testArenaDataBuffer();
+	testDataBufferViews();
+	testSharedDataBuffer();
+	testBulkDataBuffer();
+	testPersistentDataBuffer();
+	testUncheckedDataBuffer();
 
 	std::cout << CYN << "\n====== DESIGN PATTERNS tests ======" << RESET << std::endl;
 	testMemento();
@@ -15,6 +15,7 @@
 #include <sstream>
 #include <iomanip>
 #include <algorithm>
+#include <new>
 
 // Static member definition
 std::unique_ptr<Logger> Logger::_defaultLogger = nullptr;
@@ -46,6 +47,12 @@ Logger::Logger(const std::string& name, Level minLevel, const std::string& logFi
 	_fileStream.open(_logFile, std::ios::app);
 }
 
+Logger::Logger(const std::string& name, Level minLevel, std::pmr::memory_resource* historyResource)
+	: _name(name), _minLevel(minLevel), _output(Output::CONSOLE)
+	, _logHistory(historyResource), _maxHistorySize(1000), _enableHistory(false)
+	, _useColorOutput(true), _showTimestamp(true), _showCategory(true)
+	, _showLevel(true), _showLocation(false) {}
+
 Logger::~Logger() {
 	close();
 }
@@ -218,7 +225,7 @@ void Logger::clearHistory() {
 
 std::vector<Logger::LogEntry> Logger::getHistory() const {
 	std::lock_guard<std::mutex> lock(_mutex);
-	return _logHistory;
+	return std::vector<LogEntry>(_logHistory.begin(), _logHistory.end());
 }
 
 std::vector<Logger::LogEntry> Logger::getHistory(Level minLevel) const {
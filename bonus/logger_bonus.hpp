@@ -17,6 +17,7 @@
 #include <vector>
 #include <fstream>
 #include <memory>
+#include <memory_resource>
 #include <mutex>
 #include <chrono>
 #include <functional>
@@ -66,7 +67,7 @@ class Logger {
 		std::ofstream _fileStream;
 		mutable std::mutex _mutex;
 		
-		std::vector<LogEntry> _logHistory;
+		std::pmr::vector<LogEntry> _logHistory;
 		size_t _maxHistorySize;
 		bool _enableHistory;
 		
@@ -84,6 +85,8 @@ class Logger {
 		Logger(const std::string& name, Level minLevel);
 		Logger(const std::string& name, Level minLevel, Output output);
 		Logger(const std::string& name, Level minLevel, const std::string& logFile);
+		// History storage comes from `historyResource` (the entries' strings keep using the heap)
+		Logger(const std::string& name, Level minLevel, std::pmr::memory_resource* historyResource);
 		Logger(const Logger& other) = delete;
 		Logger& operator=(const Logger& other) = delete;
 		~Logger();
@@ -15,6 +15,7 @@
 #include <iostream>
 #include <cassert>
 #include <thread>
+#include <memory_resource>
 
 void testTimer() {
 	std::cout << YEL << "\n=== Testing Timer ===" << RESET << std::endl;
@@ -192,6 +193,13 @@ void testLogger() {
 				<< "] " << history[i].message << std::endl;
 	}
 	
+	std::byte historyBuffer[4096];
+	std::pmr::monotonic_buffer_resource historyArena(historyBuffer, sizeof(historyBuffer));
+	Logger arenaLogger("ArenaLogger", Logger::Level::DEBUG, &historyArena);
+	arenaLogger.enableHistory(true, 10);
+	arenaLogger.debug("Kept in a stack buffer");
+	std::cout << "History in a caller-provided resource: " << arenaLogger.getHistorySize() << " entry" << std::endl;
+
 	std::cout << MAG << "\n=== Test category filtering ===" << RESET << std::endl;
 	logger.addCategoryFilter("NETWORK");
 	logger.addCategoryFilter("SECURITY");
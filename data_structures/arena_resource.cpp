@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena_resource.cpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hmunoz-g <hmunoz-g@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:10:52 by hmunoz-g          #+#    #+#             */
+/*   Updated: 2026/10/18 17:10:52 by hmunoz-g         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "arena_resource.hpp"
+
+#include <memory>
+
+ArenaResource::ArenaResource(size_t chunkSize, std::pmr::memory_resource *upstreamResource)
+	: upstream(upstreamResource), chunk_size(chunkSize > 0 ? chunkSize : 1), current(0), offset(0), used(0) {}
+
+ArenaResource::~ArenaResource() {
+	release();
+}
+
+void *ArenaResource::do_allocate(size_t bytes, size_t alignment) {
+	// Bump inside the current chunk, moving on to later (kept) chunks when full
+	for (; current < chunks.size(); ++current, offset = 0) {
+		void *cursor = chunks[current].data + offset;
+		size_t space = chunks[current].size - offset;
+		if (std::align(alignment, bytes, cursor, space)) {
+			offset = chunks[current].size - space + bytes;
+			used += bytes;
+			return cursor;
+		}
+	}
+
+	size_t size = bytes + alignment > chunk_size ? bytes + alignment : chunk_size;
+	Chunk chunk = {static_cast<std::byte*>(upstream->allocate(size, alignof(std::max_align_t))), size};
+	chunks.push_back(chunk);
+	current = chunks.size() - 1;
+	offset = 0;
+
+	void *cursor = chunk.data;
+	size_t space = chunk.size;
+	std::align(alignment, bytes, cursor, space);
+	offset = chunk.size - space + bytes;
+	used += bytes;
+	return cursor;
+}
+
+void ArenaResource::reset() {
+	current = 0;
+	offset = 0;
+	used = 0;
+}
+
+void ArenaResource::release() {
+	for (const Chunk &chunk : chunks) {
+		upstream->deallocate(chunk.data, chunk.size, alignof(std::max_align_t));
+	}
+	chunks.clear();
+	reset();
+}
+
+size_t ArenaResource::getCapacity() const {
+	size_t capacity = 0;
+	for (const Chunk &chunk : chunks) {
+		capacity += chunk.size;
+	}
+	return capacity;
+}
\ No newline at end of file
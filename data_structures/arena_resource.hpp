@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena_resource.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hmunoz-g <hmunoz-g@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:10:52 by hmunoz-g          #+#    #+#             */
+/*   Updated: 2026/10/18 17:10:52 by hmunoz-g         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ARENA_RESOURCE_HPP
+# define ARENA_RESOURCE_HPP
+
+# include <cstddef>
+# include <memory_resource>
+# include <vector>
+
+/*
+Bump-pointer arena implementing std::pmr::memory_resource
+
+Deallocation is a no-op: reset() rewinds the arena and keeps its chunks,
+release() returns them upstream. Not synchronized.
+*/
+class ArenaResource : public std::pmr::memory_resource {
+	private:
+		struct Chunk {
+			std::byte *data;
+			size_t size;
+		};
+
+		std::pmr::memory_resource *upstream;
+		std::vector<Chunk> chunks;
+		size_t chunk_size;
+		size_t current;
+		size_t offset;
+		size_t used;
+
+	protected:
+		void *do_allocate(size_t bytes, size_t alignment) override;
+		void do_deallocate(void *, size_t, size_t) override {}
+		bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+			return this == &other;
+		}
+
+	public:
+		explicit ArenaResource(size_t chunkSize = 64 * 1024,
+			std::pmr::memory_resource *upstreamResource = std::pmr::get_default_resource());
+		~ArenaResource();
+
+		ArenaResource(const ArenaResource &) = delete;
+		ArenaResource &operator=(const ArenaResource &) = delete;
+
+		// Forgets every allocation but keeps the chunks for reuse
+		void reset();
+		// Forgets every allocation and returns the chunks upstream
+		void release();
+
+		// Bytes handed out since the last reset, and bytes held in chunks
+		size_t getUsed() const { return used; }
+		size_t getCapacity() const;
+		size_t getChunkCount() const { return chunks.size(); }
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,56 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   byte_span.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hmunoz-g <hmunoz-g@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:02:19 by hmunoz-g          #+#    #+#             */
+/*   Updated: 2026/10/18 11:02:19 by hmunoz-g         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BYTE_SPAN_HPP
+# define BYTE_SPAN_HPP
+
+# include <cstddef>
+# include <string_view>
+# include <stdexcept>
+
+/*
+Non-owning, read-only view over a run of bytes (a C++17 stand-in for
+std::span<const std::byte>). It never allocates nor copies; it is only valid
+while the memory it points to stays alive and unmodified.
+*/
+class ByteSpan {
+	private:
+		const std::byte *ptr;
+		size_t length;
+
+	public:
+		constexpr ByteSpan(): ptr(nullptr), length(0) {}
+		constexpr ByteSpan(const std::byte *data, size_t size): ptr(data), length(size) {}
+		ByteSpan(const void *data, size_t size): ptr(static_cast<const std::byte*>(data)), length(size) {}
+
+		constexpr const std::byte *data() const { return ptr; }
+		constexpr size_t size() const { return length; }
+		constexpr bool empty() const { return length == 0; }
+
+		constexpr const std::byte *begin() const { return ptr; }
+		constexpr const std::byte *end() const { return ptr + length; }
+
+		constexpr const std::byte &operator[](size_t index) const { return ptr[index]; }
+
+		ByteSpan subspan(size_t offset, size_t count) const {
+			if (offset > length || count > length - offset) {
+				throw std::out_of_range("ByteSpan subspan out of range");
+			}
+			return ByteSpan(ptr + offset, count);
+		}
+
+		std::string_view asString() const {
+			return std::string_view(reinterpret_cast<const char*>(ptr), length);
+		}
+};
+
+#endif
\ No newline at end of file
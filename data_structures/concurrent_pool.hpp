@@ -0,0 +1,275 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_pool.hpp                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hmunoz-g <hmunoz-g@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:14:27 by hmunoz-g          #+#    #+#             */
+/*   Updated: 2026/10/19 09:14:27 by hmunoz-g         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef CONCURRENT_POOL_HPP
+# define CONCURRENT_POOL_HPP
+
+# include <atomic>
+# include <cstddef>
+# include <cstdint>
+# include <memory>
+# include <optional>
+# include <stdexcept>
+# include <utility>
+
+# include "pool_storage.hpp"
+
+/*
+Thread-safe counterpart of Pool with a fixed capacity
+
+Free slots live in a lock-free, version-tagged stack. A ThreadCache keeps a
+per-thread magazine of slots and must be destroyed on its thread, before the pool.
+*/
+template <typename TType, size_t SlotAlignment = alignof(TType)>
+class ConcurrentPool {
+	public:
+		class Object {
+			private:
+				TType *ptr;
+				ConcurrentPool *pool;
+				uint32_t index;
+
+			public:
+				Object(TType *p, ConcurrentPool *owner, uint32_t idx): ptr(p), pool(owner), index(idx) {}
+				~Object() { reset(); }
+
+				Object(Object &&other) noexcept: ptr(other.ptr), pool(other.pool), index(other.index) {
+					other.ptr = nullptr;
+					other.pool = nullptr;
+				}
+
+				Object &operator=(Object &&other) noexcept {
+					if (this != &other) {
+						reset();
+						ptr = other.ptr;
+						pool = other.pool;
+						index = other.index;
+						other.ptr = nullptr;
+						other.pool = nullptr;
+					}
+					return *this;
+				}
+
+				Object(const Object&) = delete;
+				Object &operator=(const Object &) = delete;
+
+				// Destroys the object and gives its slot back to the pool early
+				void reset() {
+					if (pool && ptr) {
+						ptr->~TType();
+						pool->release(index);
+						ptr = nullptr;
+						pool = nullptr;
+					}
+				}
+
+				TType *operator->() { return ptr; }
+				TType &operator*() { return *ptr; }
+
+				// Gives up ownership without destroying the object; the slot has to
+				// be handed back with ConcurrentPool::returnObject() once the object is gone
+				TType *release() {
+					TType *released = ptr;
+					ptr = nullptr;
+					pool = nullptr;
+					return released;
+				}
+		};
+
+		class ThreadCache {
+			private:
+				static constexpr size_t magazineSize = 32;
+
+				ConcurrentPool *pool;
+				ThreadCache *previous;
+				uint32_t slots[magazineSize];
+				size_t count;
+
+				friend class ConcurrentPool;
+
+			public:
+				explicit ThreadCache(ConcurrentPool &owner): pool(&owner), previous(current), count(0) {
+					current = this;
+				}
+
+				~ThreadCache() {
+					while (count > 0) {
+						pool->pushFree(slots[--count]);
+					}
+					current = previous;
+				}
+
+				ThreadCache(const ThreadCache &) = delete;
+				ThreadCache &operator=(const ThreadCache &) = delete;
+		};
+
+	private:
+		static constexpr uint32_t emptyIndex = 0xFFFFFFFFu;
+		static constexpr uint64_t indexMask = 0xFFFFFFFFull;
+
+		using Layout = PoolSlotLayout<TType, SlotAlignment>;
+
+		static thread_local ThreadCache *current;
+
+		AlignedBytes storage;
+		std::unique_ptr<std::atomic<uint32_t>[]> next;
+		size_t capacity;
+		alignas(cacheLineSize) std::atomic<uint64_t> head;
+		char head_padding[cacheLineSize - sizeof(std::atomic<uint64_t>)];
+
+		TType *slot(uint32_t index) const {
+			return reinterpret_cast<TType*>(storage.get() + static_cast<size_t>(index) * Layout::stride);
+		}
+
+		static uint64_t pack(uint64_t version, uint32_t index) {
+			return (version << 32) | index;
+		}
+
+		void pushFree(uint32_t index) {
+			uint64_t old = head.load(std::memory_order_relaxed);
+			uint64_t desired;
+			do {
+				next[index].store(static_cast<uint32_t>(old & indexMask), std::memory_order_relaxed);
+				desired = pack((old >> 32) + 1, index);
+			} while (!head.compare_exchange_weak(old, desired, std::memory_order_release, std::memory_order_relaxed));
+		}
+
+		uint32_t popFree() {
+			uint64_t old = head.load(std::memory_order_acquire);
+			while (true) {
+				uint32_t index = static_cast<uint32_t>(old & indexMask);
+				if (index == emptyIndex) {
+					return emptyIndex;
+				}
+				uint32_t following = next[index].load(std::memory_order_relaxed);
+				if (head.compare_exchange_weak(old, pack((old >> 32) + 1, following),
+						std::memory_order_acquire, std::memory_order_acquire)) {
+					return index;
+				}
+			}
+		}
+
+		ThreadCache *localCache() {
+			ThreadCache *cache = current;
+			return (cache && cache->pool == this) ? cache : nullptr;
+		}
+
+		uint32_t take() {
+			ThreadCache *cache = localCache();
+			if (!cache) {
+				return popFree();
+			}
+			if (cache->count == 0) {
+				while (cache->count < ThreadCache::magazineSize / 2) {
+					uint32_t index = popFree();
+					if (index == emptyIndex) {
+						break;
+					}
+					cache->slots[cache->count++] = index;
+				}
+				if (cache->count == 0) {
+					return emptyIndex;
+				}
+			}
+			return cache->slots[--cache->count];
+		}
+
+		void release(uint32_t index) {
+			ThreadCache *cache = localCache();
+			if (!cache) {
+				pushFree(index);
+				return;
+			}
+			if (cache->count == ThreadCache::magazineSize) {
+				while (cache->count > ThreadCache::magazineSize / 2) {
+					pushFree(cache->slots[--cache->count]);
+				}
+			}
+			cache->slots[cache->count++] = index;
+		}
+
+		template<typename... TArgs>
+		Object construct(uint32_t index, TArgs&&... args) {
+			TType *ptr = slot(index);
+			try {
+				new(ptr) TType(std::forward<TArgs>(args)...);
+			} catch (...) {
+				release(index);
+				throw;
+			}
+			return Object(ptr, this, index);
+		}
+
+	public:
+		ConcurrentPool(): storage(nullptr, AlignedDeleter{Layout::alignment}), capacity(0), head(pack(0, emptyIndex)) {}
+		explicit ConcurrentPool(size_t numberOfObjects): ConcurrentPool() {
+			resize(numberOfObjects);
+		}
+		~ConcurrentPool() = default;
+
+		ConcurrentPool(const ConcurrentPool &) = delete;
+		ConcurrentPool &operator=(const ConcurrentPool &) = delete;
+
+		// Not thread-safe: set the capacity before sharing the pool, with no object in use
+		void resize(size_t numberOfObjects) {
+			if (numberOfObjects >= emptyIndex) {
+				throw std::length_error("ConcurrentPool capacity is limited to 32-bit indices");
+			}
+			storage = allocateAligned(numberOfObjects * Layout::stride, Layout::alignment);
+			next = std::make_unique<std::atomic<uint32_t>[]>(numberOfObjects);
+			capacity = numberOfObjects;
+
+			// Chain every slot so that index 0 is handed out first
+			for (size_t i = 0; i < numberOfObjects; ++i) {
+				uint32_t following = (i + 1 < numberOfObjects) ? static_cast<uint32_t>(i + 1) : emptyIndex;
+				next[i].store(following, std::memory_order_relaxed);
+			}
+			head.store(pack(0, numberOfObjects > 0 ? 0 : emptyIndex), std::memory_order_release);
+		}
+
+		size_t getCapacity() const { return capacity; }
+
+		// Whether `ptr` points into this pool's storage
+		bool owns(const TType *ptr) const {
+			const std::byte *address = reinterpret_cast<const std::byte*>(ptr);
+			return address >= storage.get() && address < storage.get() + capacity * Layout::stride;
+		}
+
+		// Takes back the slot of an object released from its Object and already destroyed
+		void returnObject(TType *ptr) {
+			size_t offset = static_cast<size_t>(reinterpret_cast<std::byte*>(ptr) - storage.get());
+			release(static_cast<uint32_t>(offset / Layout::stride));
+		}
+
+		template<typename... TArgs>
+		Object acquire(TArgs&&... args) {
+			uint32_t index = take();
+			if (index == emptyIndex) {
+				throw std::runtime_error("Pool is empty");
+			}
+			return construct(index, std::forward<TArgs>(args)...);
+		}
+
+		template<typename... TArgs>
+		std::optional<Object> tryAcquire(TArgs&&... args) {
+			uint32_t index = take();
+			if (index == emptyIndex) {
+				return std::nullopt;
+			}
+			return construct(index, std::forward<TArgs>(args)...);
+		}
+};
+
+template <typename TType, size_t SlotAlignment>
+thread_local typename ConcurrentPool<TType, SlotAlignment>::ThreadCache *ConcurrentPool<TType, SlotAlignment>::current = nullptr;
+
+#endif
\ No newline at end of file
@@ -0,0 +1,188 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   data_buffer.cpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hmunoz-g <hmunoz-g@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:40:12 by hmunoz-g          #+#    #+#             */
+/*   Updated: 2026/10/18 15:40:12 by hmunoz-g         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "data_buffer.hpp"
+
+#include <fstream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static size_t alignFileOffset(size_t offset) {
+	return (offset + DataBufferFormat::fileAlignment - 1) & ~(DataBufferFormat::fileAlignment - 1);
+}
+
+static DataBufferFileHeader makeHeader(size_t recordCount, size_t arenaBytes) {
+	DataBufferFileHeader header = {};
+
+	std::memcpy(header.magic, DataBufferFormat::magic, sizeof(header.magic));
+	header.version = DataBufferFormat::version;
+	header.byteOrder = DataBufferFormat::byteOrder;
+	header.recordCount = recordCount;
+	header.arenaBytes = arenaBytes;
+	header.indexOffset = alignFileOffset(sizeof(DataBufferFileHeader));
+	header.arenaOffset = alignFileOffset(header.indexOffset + recordCount * sizeof(DataBufferRecord));
+
+	return header;
+}
+
+// Every record must lie in its arena, nested buffers are checked the same way inside their record
+static void validateRecords(const std::byte *arena, uint64_t arenaBytes, const DataBufferRecord *records, uint64_t count) {
+	for (uint64_t i = 0; i < count; ++i) {
+		if (records[i].offset > arenaBytes || records[i].size > arenaBytes - records[i].offset) {
+			throw std::runtime_error("Corrupted snapshot record");
+		}
+		if (records[i].tag != DataBufferFormat::nestedTag) {
+			continue;
+		}
+
+		const std::byte *payload = arena + records[i].offset;
+		DataBufferNestedHeader nested;
+		if (records[i].size < sizeof(nested)) {
+			throw std::runtime_error("Corrupted snapshot record");
+		}
+		std::memcpy(&nested, payload, sizeof(nested));
+		if (!DataBufferFormat::nestedFits(nested, records[i].size)) {
+			throw std::runtime_error("Corrupted snapshot record");
+		}
+		validateRecords(payload + DataBufferFormat::nestedArenaOffset(nested.count), nested.bytes,
+			reinterpret_cast<const DataBufferRecord*>(payload + sizeof(nested)), nested.count);
+	}
+}
+
+// Checks everything needed to read records in place
+static void validateSnapshot(const std::byte *file, size_t fileSize, DataBufferFileHeader &header) {
+	if (fileSize < sizeof(DataBufferFileHeader)) {
+		throw std::runtime_error("Snapshot file too small");
+	}
+	std::memcpy(&header, file, sizeof(header));
+
+	if (std::memcmp(header.magic, DataBufferFormat::magic, sizeof(header.magic)) != 0) {
+		throw std::runtime_error("Not a DataBuffer snapshot file");
+	}
+	if (header.version != DataBufferFormat::version) {
+		throw std::runtime_error("Unsupported snapshot version");
+	}
+	if (header.byteOrder != DataBufferFormat::byteOrder) {
+		throw std::runtime_error("Snapshot written with a different byte order");
+	}
+	// Offsets are bounded first so that no difference below can wrap
+	if (header.indexOffset > fileSize || header.arenaOffset > fileSize
+		|| header.indexOffset < sizeof(DataBufferFileHeader)
+		|| header.indexOffset > header.arenaOffset
+		|| header.indexOffset % DataBufferFormat::fileAlignment != 0
+		|| header.arenaOffset % DataBufferFormat::fileAlignment != 0
+		|| header.recordCount > (header.arenaOffset - header.indexOffset) / sizeof(DataBufferRecord)
+		|| header.arenaBytes > fileSize - header.arenaOffset) {
+		throw std::runtime_error("Corrupted snapshot file layout");
+	}
+
+	validateRecords(file + header.arenaOffset, header.arenaBytes,
+		reinterpret_cast<const DataBufferRecord*>(file + header.indexOffset), header.recordCount);
+}
+
+MappedFile::MappedFile(const std::string &path): address(nullptr), length(0) {
+	int fd = open(path.c_str(), O_RDONLY);
+	if (fd < 0) {
+		throw std::runtime_error("Cannot open snapshot file: " + path);
+	}
+
+	struct stat info;
+	if (fstat(fd, &info) < 0) {
+		close(fd);
+		throw std::runtime_error("Cannot stat snapshot file: " + path);
+	}
+	length = static_cast<size_t>(info.st_size);
+
+	if (length > 0) {
+		address = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (address == MAP_FAILED) {
+			address = nullptr;
+			close(fd);
+			throw std::runtime_error("Cannot map snapshot file: " + path);
+		}
+	}
+	close(fd);
+}
+
+MappedFile::~MappedFile() {
+	if (address) {
+		munmap(address, length);
+	}
+}
+
+template<typename Policy>
+void BasicDataBuffer<Policy>::saveToFile(const std::string &path) const {
+	size_t recordCount = size();
+	size_t arenaBytes = byteSize();
+	DataBufferFileHeader header = makeHeader(recordCount, arenaBytes);
+	static const char padding[DataBufferFormat::fileAlignment] = {};
+
+	std::ofstream file(path, std::ios::binary | std::ios::trunc);
+	if (!file) {
+		throw std::runtime_error("Cannot create snapshot file: " + path);
+	}
+
+	file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	file.write(padding, header.indexOffset - sizeof(header));
+	if (recordCount > 0) {
+		file.write(reinterpret_cast<const char*>(storage->index()), recordCount * sizeof(Record));
+	}
+	file.write(padding, header.arenaOffset - header.indexOffset - recordCount * sizeof(Record));
+	if (arenaBytes > 0) {
+		file.write(reinterpret_cast<const char*>(storage->bytes()), arenaBytes);
+	}
+
+	if (!file.flush()) {
+		throw std::runtime_error("Cannot write snapshot file: " + path);
+	}
+}
+
+template<typename Policy>
+BasicDataBuffer<Policy> BasicDataBuffer<Policy>::loadFile(const std::string &path) {
+	BasicDataBuffer mapped = mapFile(path);
+	BasicDataBuffer result;
+
+	if (mapped.size() > 0 || mapped.byteSize() > 0) {
+		Storage &target = result.mutableStorage();
+		target.arena.assign(mapped.storage->bytes(), mapped.storage->bytes() + mapped.byteSize());
+		target.records.assign(mapped.storage->index(), mapped.storage->index() + mapped.size());
+	}
+
+	return result;
+}
+
+template<typename Policy>
+BasicDataBuffer<Policy> BasicDataBuffer<Policy>::mapFile(const std::string &path) {
+	auto file = std::make_shared<const MappedFile>(path);
+	DataBufferFileHeader header;
+	validateSnapshot(file->data(), file->size(), header);
+	if (Policy::checked && header.recordCount == 0 && header.arenaBytes > 0) {
+		throw std::runtime_error("Snapshot has no record index (saved by an unchecked buffer)");
+	}
+
+	auto mappedStorage = std::make_shared<Storage>();
+	mappedStorage->mapped_arena = file->data() + header.arenaOffset;
+	mappedStorage->mapped_bytes = header.arenaBytes;
+	mappedStorage->mapped_records = reinterpret_cast<const Record*>(file->data() + header.indexOffset);
+	mappedStorage->mapped_count = header.recordCount;
+	mappedStorage->mapping = std::move(file);
+
+	BasicDataBuffer result;
+	result.storage = std::move(mappedStorage);
+
+	return result;
+}
+
+template class BasicDataBuffer<DataBufferChecked>;
+template class BasicDataBuffer<DataBufferUnchecked>;
\ No newline at end of file
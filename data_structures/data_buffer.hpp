@@ -6,7 +6,7 @@
 /*   By: hmunoz-g <hmunoz-g@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/09/09 12:58:07 by hmunoz-g          #+#    #+#             */
-/*   Updated: 2025/09/16 15:12:19 by hmunoz-g         ###   ########.fr       */
+/*   Updated: 2026/10/18 11:20:03 by hmunoz-g         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,76 +14,308 @@
 # define DATA_BUFFER_HPP
 
 # include <vector>
-# include <cstddef>
 # include <memory>
-# include <typeinfo>
+# include <utility>
+# include <cstddef>
+# include <cstdint>
+# include <type_traits>
 # include <cstring>
 # include <stdexcept>
+# include <string>
+# include <string_view>
+
+# include "byte_span.hpp"
+# include "data_buffer_format.hpp"
+# include "data_buffer_view.hpp"
+
+/*
+DataBuffer stores every serialized value in one contiguous byte arena
+
+Copies share the storage until one of them is written to. Span, string_view
+and DataBufferView reads are invalidated by the next write.
+*/
+// Allocator whose value-less construct() leaves the element uninitialised, so
+// growing the arena right before a memcpy does not zero the bytes first
+template<typename T>
+struct DataBufferArenaAllocator : std::allocator<T> {
+	template<typename U>
+	struct rebind {
+		using other = DataBufferArenaAllocator<U>;
+	};
+
+	DataBufferArenaAllocator() noexcept = default;
+	template<typename U>
+	DataBufferArenaAllocator(const DataBufferArenaAllocator<U> &) noexcept {}
 
-class DataBuffer {
+	template<typename U>
+	void construct(U *ptr) noexcept(std::is_nothrow_default_constructible<U>::value) {
+		::new(static_cast<void*>(ptr)) U;
+	}
+
+	template<typename U, typename... TArgs>
+	void construct(U *ptr, TArgs&&... args) {
+		::new(static_cast<void*>(ptr)) U(std::forward<TArgs>(args)...);
+	}
+};
+
+template<typename Policy = DataBufferChecked>
+class BasicDataBuffer {
 	private:
-		std::vector<std::unique_ptr<std::byte[]>> data_chunks;
-		std::vector<size_t> sizes;
-		std::vector<const std::type_info*> types;
+		using Record = DataBufferRecord;
+		using View = BasicDataBufferView<Policy>;
+
+		struct Storage {
+			std::vector<std::byte, DataBufferArenaAllocator<std::byte>> arena;
+			std::vector<Record> records;
+
+			// Set when the bytes are read in place from a mapped snapshot file
+			std::shared_ptr<const MappedFile> mapping;
+			const std::byte *mapped_arena = nullptr;
+			size_t mapped_bytes = 0;
+			const Record *mapped_records = nullptr;
+			size_t mapped_count = 0;
+
+			const std::byte *bytes() const { return mapping ? mapped_arena : arena.data(); }
+			size_t byteCount() const { return mapping ? mapped_bytes : arena.size(); }
+			const Record *index() const { return mapping ? mapped_records : records.data(); }
+			size_t recordCount() const { return mapping ? mapped_count : records.size(); }
+		};
+
+		std::shared_ptr<Storage> storage;
 		size_t read_position;
+		size_t read_offset;
+
+		static size_t alignUp(size_t offset, size_t alignment) {
+			return DataBufferFormat::alignUp(offset, alignment);
+		}
+
+		// Storage about to be written: created on first use, detached if shared or mapped
+		Storage &mutableStorage() {
+			if (!storage) {
+				storage = std::make_shared<Storage>();
+			} else if (storage->mapping) {
+				auto copy = std::make_shared<Storage>();
+				copy->arena.assign(storage->bytes(), storage->bytes() + storage->byteCount());
+				copy->records.assign(storage->index(), storage->index() + storage->recordCount());
+				storage = std::move(copy);
+			} else if (storage.use_count() > 1) {
+				storage = std::make_shared<Storage>(*storage);
+			}
+			return (*storage);
+		}
+
+		// Grows the arena for one record and returns where its payload goes
+		std::byte *reserveRecord(size_t size, size_t alignment, uint32_t tag, bool lengthPrefixed) {
+			Storage &target = mutableStorage();
+			size_t start = target.arena.size();
+			size_t offset = start;
+
+			if (lengthPrefixed) {
+				offset = alignUp(offset, alignof(uint64_t)) + sizeof(uint64_t);
+			}
+			offset = alignUp(offset, alignment);
+			// New bytes are left uninitialised: only the padding is zeroed, the
+			// caller writes the payload
+			target.arena.resize(offset + size);
+			if (offset > start) {
+				std::memset(target.arena.data() + start, 0, offset - start);
+			}
+
+			if (lengthPrefixed) {
+				uint64_t length = size;
+				std::memcpy(target.arena.data() + offset - sizeof(uint64_t), &length, sizeof(length));
+			}
+			if constexpr (Policy::checked) {
+				target.records.push_back({offset, size, tag, 0});
+			} else {
+				(void)tag;
+			}
+
+			return (target.arena.data() + offset);
+		}
+
+		void appendRecord(const void *data, size_t size, size_t alignment, uint32_t tag, bool lengthPrefixed) {
+			std::byte *payload = reserveRecord(size, alignment, tag, lengthPrefixed);
+			if (size > 0) {
+				std::memcpy(payload, data, size);
+			}
+		}
 
 	public:
-		DataBuffer() : read_position(0) {}
-	
+		BasicDataBuffer() : read_position(0), read_offset(0) {}
+
 		// Copy constructor and assignment operator overload (needed for some Design Patterns)
-		DataBuffer(const DataBuffer &other): read_position(0) {
-			*this = other;
+		// Copies share the stored bytes until one of them is written to
+		BasicDataBuffer(const BasicDataBuffer &other) = default;
+		BasicDataBuffer &operator=(const BasicDataBuffer &other) = default;
+
+		BasicDataBuffer(BasicDataBuffer &&other) noexcept
+			: storage(std::move(other.storage)), read_position(other.read_position), read_offset(other.read_offset) {
+			other.read_position = 0;
+			other.read_offset = 0;
 		}
 
-		DataBuffer &operator=(const DataBuffer &other) {
+		BasicDataBuffer &operator=(BasicDataBuffer &&other) noexcept {
 			if (this != &other) {
-				data_chunks.clear();
-				sizes.clear();
-				types.clear();
-				read_position = 0;
-
-				if (other.data_chunks.size() > 0) {
-					sizes = other.sizes;
-					types = other.types;
-					read_position = other.read_position;
-					data_chunks.reserve(other.data_chunks.size());
-					
-					for (size_t i = 0; i < other.data_chunks.size(); ++i) {
-						auto new_chunk = std::make_unique<std::byte[]>(sizes[i]);
-						std::memcpy(new_chunk.get(), other.data_chunks[i].get(), sizes[i]);
-						data_chunks.push_back(std::move(new_chunk));
-					}
-				}
+				storage = std::move(other.storage);
+				read_position = other.read_position;
+				read_offset = other.read_offset;
+				other.read_position = 0;
+				other.read_offset = 0;
 			}
-
 			return (*this);
 		}
-	
+
+		// Preallocate room for `bytes` of payload spread over `count` values
+		void reserve(size_t bytes, size_t count) {
+			Storage &target = mutableStorage();
+			target.arena.reserve(bytes);
+			target.records.reserve(count);
+		}
+
+		// Drops the contents; capacity is kept for reuse unless the storage is shared
+		void clear() {
+			if (storage && storage.use_count() == 1 && !storage->mapping) {
+				storage->arena.clear();
+				storage->records.clear();
+			} else {
+				storage.reset();
+			}
+			read_position = 0;
+			read_offset = 0;
+		}
+
+		void rewind() { read_position = 0; read_offset = 0; }
+
+		// Number of indexed records (always 0 for unchecked buffers, which keep no index)
+		size_t size() const { return storage ? storage->recordCount() : 0; }
+		size_t byteSize() const { return storage ? storage->byteCount() : 0; }
+		bool empty() const { return byteSize() == 0 && size() == 0; }
+		bool isShared() const { return storage && storage.use_count() > 1; }
+		bool isMapped() const { return storage && storage->mapping; }
+
+		// Snapshot files (see data_buffer_format.hpp), throw std::runtime_error on failure
+		void saveToFile(const std::string &path) const;
+		static BasicDataBuffer loadFile(const std::string &path);
+		static BasicDataBuffer mapFile(const std::string &path);
+
 		// Serialization
 		template<typename T>
-		DataBuffer &operator<<(const T &obj) {
-			sizes.push_back(sizeof(T));
-			types.push_back(&typeid(T));
-			data_chunks.push_back(std::make_unique<std::byte[]>(sizeof(T)));
-			std::memcpy(data_chunks.back().get(), &obj, sizeof(T));
-			
+		BasicDataBuffer &operator<<(const T &obj) {
+			static_assert(std::is_trivially_copyable<T>::value, "DataBuffer can only write trivially copyable types");
+			appendRecord(&obj, sizeof(T), alignof(T), DataBufferTypeTag<T>::value, false);
+			return (*this);
+		}
+
+		// Bulk writes: the whole range becomes one record copied in one operation
+		template<typename T>
+		BasicDataBuffer &writeArray(const T *data, size_t count) {
+			static_assert(std::is_trivially_copyable<T>::value, "DataBuffer can only write trivially copyable types");
+			appendRecord(data, count * sizeof(T), alignof(T), DataBufferTypeTag<std::vector<T>>::value, true);
 			return (*this);
 		}
 
-		// Deserialization
 		template<typename T>
-		DataBuffer &operator>>(T& obj) {
-			if (read_position >= data_chunks.size()) {
-				throw std::out_of_range("No more data to read");
+		BasicDataBuffer &operator<<(const std::vector<T> &values) {
+			return (writeArray(values.data(), values.size()));
+		}
+
+		// Blobs are copied into the arena once and can later be read back as views
+		BasicDataBuffer &writeBytes(const void *data, size_t size) {
+			appendRecord(data, size, alignof(std::max_align_t), DataBufferTypeTag<ByteSpan>::value, true);
+			return (*this);
+		}
+
+		BasicDataBuffer &operator<<(const ByteSpan &span) {
+			return (writeBytes(span.data(), span.size()));
+		}
+
+		// All string flavours share one record type and read back as std::string or std::string_view
+		BasicDataBuffer &operator<<(std::string_view str) {
+			appendRecord(str.data(), str.size(), 1, DataBufferTypeTag<std::string_view>::value, true);
+			return (*this);
+		}
+
+		BasicDataBuffer &operator<<(const std::string &str) {
+			return (*this << std::string_view(str));
+		}
+
+		BasicDataBuffer &operator<<(const char *str) {
+			return (*this << std::string_view(str));
+		}
+
+		// Nested buffers are stored as their header, index and arena back to back
+		BasicDataBuffer &operator<<(const BasicDataBuffer &nested) {
+			// Holding a reference forces a detach when a buffer is written into itself
+			std::shared_ptr<Storage> source = nested.storage;
+			size_t recordCount = source ? source->recordCount() : 0;
+			size_t arenaBytes = source ? source->byteCount() : 0;
+			size_t arenaOffset = DataBufferFormat::nestedArenaOffset(recordCount);
+
+			std::byte *payload = reserveRecord(arenaOffset + arenaBytes, DataBufferFormat::nestedAlignment,
+				DataBufferTypeTag<View>::value, true);
+			DataBufferNestedHeader header = {recordCount, arenaBytes};
+			std::memcpy(payload, &header, sizeof(header));
+			if (recordCount > 0) {
+				std::memcpy(payload + sizeof(header), source->index(), recordCount * sizeof(Record));
 			}
-			if (typeid(T) != *types[read_position]) {
-				throw std::invalid_argument("Type mismatch");
+			size_t indexEnd = sizeof(header) + recordCount * sizeof(Record);
+			std::memset(payload + indexEnd, 0, arenaOffset - indexEnd);
+			if (arenaBytes > 0) {
+				std::memcpy(payload + arenaOffset, source->bytes(), arenaBytes);
 			}
-			std::memcpy(&obj, data_chunks[read_position].get(), sizes[read_position]);
-			read_position++;
 
 			return (*this);
 		}
+
+		// Deserialization
+		// ByteSpan, std::string_view and DataBufferView targets are filled with views into the arena
+		template<typename T>
+		BasicDataBuffer &operator>>(T& obj) {
+			View cursor = view();
+			cursor >> obj;
+			read_position = cursor.position();
+			read_offset = cursor.offset();
+
+			return (*this);
+		}
+
+		template<typename T>
+		size_t readArray(T *out, size_t capacity) {
+			View cursor = view();
+			size_t elements = cursor.readArray(out, capacity);
+			read_position = cursor.position();
+			read_offset = cursor.offset();
+
+			return (elements);
+		}
+
+		// Nested buffers come back as an independent buffer holding a copy of their bytes
+		BasicDataBuffer &operator>>(BasicDataBuffer &nested) {
+			View inner;
+			*this >> inner;
+
+			BasicDataBuffer result;
+			if (inner.size() > 0 || inner.byteSize() > 0) {
+				Storage &target = result.mutableStorage();
+				target.records.assign(inner.index(), inner.index() + inner.size());
+				target.arena.assign(inner.data(), inner.data() + inner.byteSize());
+			}
+			nested = std::move(result);
+
+			return (*this);
+		}
+
+		// Non-owning reader starting at the current read position
+		View view() const {
+			if (!storage) {
+				return View(nullptr, 0, nullptr, 0, read_position, read_offset);
+			}
+			return View(storage->bytes(), storage->byteCount(),
+				storage->index(), storage->recordCount(), read_position, read_offset);
+		}
 };
 
+using DataBuffer = BasicDataBuffer<DataBufferChecked>;
+
 #endif
\ No newline at end of file
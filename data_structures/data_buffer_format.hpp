@@ -0,0 +1,184 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   data_buffer_format.hpp                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hmunoz-g <hmunoz-g@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:02:36 by hmunoz-g          #+#    #+#             */
+/*   Updated: 2026/10/18 15:02:36 by hmunoz-g         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef DATA_BUFFER_FORMAT_HPP
+# define DATA_BUFFER_FORMAT_HPP
+
+# include <cstddef>
+# include <cstdint>
+# include <string>
+# include <string_view>
+# include <type_traits>
+# include <vector>
+
+# include "byte_span.hpp"
+
+template<typename Policy>
+class BasicDataBufferView;
+
+/*
+Layout shared by in-memory DataBuffers and snapshot files (native byte order)
+
+	[DataBufferFileHeader][pad][DataBufferRecord x recordCount][pad][arena]
+*/
+
+// One entry of the DataBuffer index: where a value lives in the arena and what it is
+struct DataBufferRecord {
+	uint64_t offset;
+	uint64_t size;
+	uint32_t tag;
+	uint32_t reserved;
+};
+
+// Header of a nested buffer payload, followed by its index and then its arena
+struct DataBufferNestedHeader {
+	uint64_t count;
+	uint64_t bytes;
+};
+
+struct DataBufferFileHeader {
+	char magic[8];
+	uint32_t version;
+	uint32_t byteOrder;
+	uint64_t recordCount;
+	uint64_t arenaBytes;
+	uint64_t indexOffset;
+	uint64_t arenaOffset;
+};
+
+namespace DataBufferFormat {
+	constexpr char magic[8] = {'F', 'T', 'P', 'P', 'D', 'B', 'U', 'F'};
+	constexpr uint32_t version = 1;
+	constexpr uint32_t byteOrder = 0x01020304;
+	constexpr size_t fileAlignment = 64;
+
+	// Reserved tags, every other tag is either arithmetic or a type name hash
+	constexpr uint32_t stringTag = 1;
+	constexpr uint32_t bytesTag = 2;
+	constexpr uint32_t nestedTag = 3;
+	constexpr uint32_t arrayFlag = 0x80000000u;
+
+	constexpr size_t alignUp(size_t offset, size_t alignment) {
+		return (offset + alignment - 1) & ~(alignment - 1);
+	}
+
+	// Nested arenas keep the alignment they had in their own buffer
+	constexpr size_t nestedAlignment = alignof(std::max_align_t);
+
+	constexpr size_t nestedArenaOffset(size_t recordCount) {
+		return alignUp(sizeof(DataBufferNestedHeader) + recordCount * sizeof(DataBufferRecord), nestedAlignment);
+	}
+
+	// Whether a nested payload of `size` bytes holds the index and arena its header announces
+	constexpr bool nestedFits(const DataBufferNestedHeader &header, uint64_t size) {
+		return header.count <= (size - sizeof(DataBufferNestedHeader)) / sizeof(DataBufferRecord)
+			&& nestedArenaOffset(header.count) <= size
+			&& header.bytes <= size - nestedArenaOffset(header.count);
+	}
+
+	// FNV-1a over the compiler's spelling of T (stable for a given compiler)
+	template<typename T>
+	constexpr uint32_t hashTypeName() {
+		const char *name = __PRETTY_FUNCTION__;
+		uint32_t hash = 2166136261u;
+		for (; *name; ++name) {
+			hash ^= static_cast<unsigned char>(*name);
+			hash *= 16777619u;
+		}
+		// Keep clear of the reserved tags and the array flag
+		return ((hash & ~arrayFlag) | 0x10000u);
+	}
+
+	// Arithmetic types are tagged by kind and size, so int64_t/long/long long agree
+	template<typename T>
+	constexpr uint32_t arithmeticTag() {
+		uint32_t kind = std::is_same<T, bool>::value ? 1
+			: std::is_floating_point<T>::value ? 2
+			: std::is_signed<T>::value ? 3 : 4;
+		return ((kind << 8) | static_cast<uint32_t>(sizeof(T)));
+	}
+}
+
+/*
+Stable tag stored with every record and compared on read
+
+Specialize it to pin a user type to a fixed tag, e.g.:
+	template<> struct DataBufferTypeTag<Point> { static constexpr uint32_t value = 0x4000; };
+*/
+template<typename T, typename = void>
+struct DataBufferTypeTag {
+	static constexpr uint32_t value = DataBufferFormat::hashTypeName<T>();
+};
+
+template<typename T>
+struct DataBufferTypeTag<T, typename std::enable_if<std::is_arithmetic<T>::value>::type> {
+	static constexpr uint32_t value = DataBufferFormat::arithmeticTag<T>();
+};
+
+template<typename T>
+struct DataBufferTypeTag<std::vector<T>> {
+	static constexpr uint32_t value = DataBufferTypeTag<T>::value | DataBufferFormat::arrayFlag;
+};
+
+template<>
+struct DataBufferTypeTag<std::string_view> {
+	static constexpr uint32_t value = DataBufferFormat::stringTag;
+};
+
+template<>
+struct DataBufferTypeTag<ByteSpan> {
+	static constexpr uint32_t value = DataBufferFormat::bytesTag;
+};
+
+template<typename Policy>
+struct DataBufferTypeTag<BasicDataBufferView<Policy>> {
+	static constexpr uint32_t value = DataBufferFormat::nestedTag;
+};
+
+/*
+Read policies for DataBuffer / DataBufferView
+
+Unchecked buffers keep no index and read with a bare memcpy, so the schema
+must match exactly. DataBufferDebugChecked is checked unless NDEBUG is defined.
+*/
+struct DataBufferChecked {
+	static constexpr bool checked = true;
+};
+
+struct DataBufferUnchecked {
+	static constexpr bool checked = false;
+};
+
+# ifdef NDEBUG
+using DataBufferDebugChecked = DataBufferUnchecked;
+# else
+using DataBufferDebugChecked = DataBufferChecked;
+# endif
+
+// Read-only memory mapping of a whole file, unmapped on destruction
+class MappedFile {
+	private:
+		void *address;
+		size_t length;
+
+	public:
+		explicit MappedFile(const std::string &path);
+		~MappedFile();
+
+		MappedFile(const MappedFile &) = delete;
+		MappedFile &operator=(const MappedFile &) = delete;
+
+		const std::byte *data() const { return static_cast<const std::byte*>(address); }
+		size_t size() const { return length; }
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,191 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   data_buffer_view.hpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hmunoz-g <hmunoz-g@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:04:51 by hmunoz-g          #+#    #+#             */
+/*   Updated: 2026/10/18 16:58:30 by hmunoz-g         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef DATA_BUFFER_VIEW_HPP
+# define DATA_BUFFER_VIEW_HPP
+
+# include <cstddef>
+# include <cstdint>
+# include <type_traits>
+# include <cstring>
+# include <stdexcept>
+# include <string>
+# include <string_view>
+# include <vector>
+
+# include "byte_span.hpp"
+# include "data_buffer_format.hpp"
+
+/*
+Non-owning reader over the arena and index of a DataBuffer
+
+Views read from it stay valid until the owning DataBuffer is written to or destroyed.
+*/
+template<typename Policy = DataBufferChecked>
+class BasicDataBufferView {
+	private:
+		const std::byte *bytes;
+		size_t byte_count;
+		const DataBufferRecord *records;
+		size_t count;
+		size_t read_position;
+		size_t read_offset;
+
+		const DataBufferRecord &nextRecord(uint32_t tag) const {
+			if (read_position >= count) {
+				throw std::out_of_range("No more data to read");
+			}
+			if (tag != records[read_position].tag) {
+				throw std::invalid_argument("Type mismatch");
+			}
+			return records[read_position];
+		}
+
+		// Locates the payload of the next record and advances the cursor past it
+		template<typename T>
+		ByteSpan nextPayload(size_t alignment, bool lengthPrefixed) {
+			if constexpr (Policy::checked) {
+				const DataBufferRecord &record = nextRecord(DataBufferTypeTag<T>::value);
+				if (!lengthPrefixed && record.size != sizeof(T)) {
+					throw std::invalid_argument("Type mismatch");
+				}
+				read_position++;
+				return ByteSpan(bytes + record.offset, record.size);
+			} else {
+				size_t offset = read_offset;
+				uint64_t size = sizeof(T);
+				if (lengthPrefixed) {
+					offset = DataBufferFormat::alignUp(offset, alignof(uint64_t));
+					std::memcpy(&size, bytes + offset, sizeof(size));
+					offset += sizeof(uint64_t);
+				}
+				offset = DataBufferFormat::alignUp(offset, alignment);
+				read_offset = offset + size;
+				return ByteSpan(bytes + offset, size);
+			}
+		}
+
+	public:
+		BasicDataBufferView()
+			: bytes(nullptr), byte_count(0), records(nullptr), count(0), read_position(0), read_offset(0) {}
+		BasicDataBufferView(const std::byte *arena, size_t arenaSize, const DataBufferRecord *index, size_t recordCount,
+			size_t position = 0, size_t offset = 0)
+			: bytes(arena), byte_count(arenaSize), records(index), count(recordCount),
+			  read_position(position), read_offset(offset) {}
+
+		size_t size() const { return count; }
+		size_t byteSize() const { return byte_count; }
+		size_t position() const { return read_position; }
+		size_t offset() const { return read_offset; }
+		size_t remaining() const { return count - read_position; }
+		void rewind() { read_position = 0; read_offset = 0; }
+
+		const std::byte *data() const { return bytes; }
+		const DataBufferRecord *index() const { return records; }
+
+		// Copying read
+		template<typename T>
+		BasicDataBufferView &operator>>(T &obj) {
+			static_assert(std::is_trivially_copyable<T>::value, "DataBuffer can only read trivially copyable types");
+			std::memcpy(&obj, nextPayload<T>(alignof(T), false).data(), sizeof(T));
+
+			return (*this);
+		}
+
+		// Bulk reads: one type check and one memcpy for the whole range
+		template<typename T>
+		BasicDataBufferView &operator>>(std::vector<T> &values) {
+			static_assert(std::is_trivially_copyable<T>::value, "DataBuffer can only read trivially copyable types");
+			ByteSpan payload = nextPayload<std::vector<T>>(alignof(T), true);
+			values.resize(payload.size() / sizeof(T));
+			if (!payload.empty()) {
+				std::memcpy(values.data(), payload.data(), payload.size());
+			}
+
+			return (*this);
+		}
+
+		// Reads an array into caller storage, returns the number of elements read
+		template<typename T>
+		size_t readArray(T *out, size_t capacity) {
+			static_assert(std::is_trivially_copyable<T>::value, "DataBuffer can only read trivially copyable types");
+			size_t position = read_position;
+			size_t offset = read_offset;
+			ByteSpan payload = nextPayload<std::vector<T>>(alignof(T), true);
+			size_t elements = payload.size() / sizeof(T);
+			if (elements > capacity) {
+				read_position = position;
+				read_offset = offset;
+				throw std::length_error("Array does not fit in the destination");
+			}
+			if (!payload.empty()) {
+				std::memcpy(out, payload.data(), payload.size());
+			}
+
+			return (elements);
+		}
+
+		BasicDataBufferView &operator>>(std::string &str) {
+			std::string_view view;
+			*this >> view;
+			str.assign(view.data(), view.size());
+
+			return (*this);
+		}
+
+		// Zero-copy reads: the result points into the arena
+		BasicDataBufferView &operator>>(ByteSpan &span) {
+			span = nextPayload<ByteSpan>(alignof(std::max_align_t), true);
+			return (*this);
+		}
+
+		BasicDataBufferView &operator>>(std::string_view &str) {
+			str = nextPayload<std::string_view>(1, true).asString();
+			return (*this);
+		}
+
+		BasicDataBufferView &operator>>(BasicDataBufferView &nested) {
+			ByteSpan record = nextPayload<BasicDataBufferView>(DataBufferFormat::nestedAlignment, true);
+			const std::byte *payload = record.data();
+			DataBufferNestedHeader header;
+			if constexpr (Policy::checked) {
+				if (record.size() < sizeof(header)) {
+					throw std::runtime_error("Corrupted nested buffer");
+				}
+			}
+			std::memcpy(&header, payload, sizeof(header));
+			if constexpr (Policy::checked) {
+				if (!DataBufferFormat::nestedFits(header, record.size())) {
+					throw std::runtime_error("Corrupted nested buffer");
+				}
+			}
+
+			nested = BasicDataBufferView(payload + DataBufferFormat::nestedArenaOffset(header.count), header.bytes,
+				reinterpret_cast<const DataBufferRecord*>(payload + sizeof(header)), header.count);
+
+			return (*this);
+		}
+
+		// Raw bytes of the next record, whatever its type
+		ByteSpan readBytes() {
+			static_assert(Policy::checked, "readBytes() needs the record index of a checked buffer");
+			if (read_position >= count) {
+				throw std::out_of_range("No more data to read");
+			}
+			const DataBufferRecord &record = records[read_position++];
+			return ByteSpan(bytes + record.offset, record.size);
+		}
+};
+
+using DataBufferView = BasicDataBufferView<DataBufferChecked>;
+
+#endif
\ No newline at end of file
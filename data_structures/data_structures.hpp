@@ -15,5 +15,14 @@
 
 # include "data_buffer.hpp"
 # include "pool.hpp"
+# include "concurrent_pool.hpp"
+# include "pool_storage.hpp"
+# include "pool_stats.hpp"
+# include "pool_resource.hpp"
+# include "arena_resource.hpp"
+# include "slot_map.hpp"
+# include "byte_span.hpp"
+# include "data_buffer_format.hpp"
+# include "data_buffer_view.hpp"
 
 #endif
\ No newline at end of file
@@ -14,23 +14,35 @@
 # define POOL_HPP
 
 # include <vector>
+# include <functional>
 # include <memory>
+# include <optional>
 # include <stdexcept>
 # include <utility>
 
+# include "pool_stats.hpp"
+# include "pool_storage.hpp"
+
+/*
+Object pool handing out RAII Objects built in preallocated storage
+
+Storage grows by slabs that never move (see setGrowth()), so live objects keep
+their address. Recycling and stats are opt-in (setRecycler(), pool_stats.hpp).
+*/
 // The pool class that manages objects
-template <typename TType>
+template <typename TType, size_t SlotAlignment = alignof(TType), typename Stats = PoolNoStats>
 class Pool {
 	public:
 		// Nested Object class - this is what users get
 		class Object {
 			private:
 				TType *ptr;
-				Pool<TType> *pool;
-				size_t index;
+				Pool *pool;
+
+				friend class Pool;
 
 			public:
-				Object(TType *p, Pool<TType> *owner, size_t idx);
+				Object(TType *p, Pool *owner);
 				~Object();
 				
 				// Move constructor/assignment
@@ -43,80 +55,314 @@ class Pool {
 
 				TType *operator->() { return ptr; }
 				TType &operator*() { return *ptr; }
+
+				// Gives up ownership without destroying the object; the slot has to
+				// be handed back with Pool::returnObject() once the object is gone
+				TType *release();
 		};
 
+		using Recycler = std::function<void(TType &)>;
+
 	private:
-		std::unique_ptr<std::byte[]> storage;
-		std::vector<size_t> free_indices;
+		using Layout = PoolSlotLayout<TType, SlotAlignment>;
+
+		std::vector<AlignedBytes> slabs;
+		std::vector<TType*> free_slots;
+		// Released objects kept alive in recycling mode, already reset
+		std::vector<TType*> recycled;
+		Recycler recycler;
 		size_t capacity;
+		size_t growth_slab_size;
+		size_t max_capacity;
+		Stats stats;
+
+		void addSlab(size_t count) {
+			slabs.push_back(allocateAligned(count * Layout::stride, Layout::alignment));
+			std::byte *slab = slabs.back().get();
+			capacity += count;
+
+			// Reverse order so consecutive acquires walk the slab forwards
+			free_slots.reserve(free_slots.size() + count);
+			for (size_t i = count; i > 0; --i) {
+				free_slots.push_back(reinterpret_cast<TType*>(slab + (i - 1) * Layout::stride));
+			}
+		}
+
+		// Grows by one slab if growth is enabled, never passing max_capacity
+		bool grow() {
+			size_t count = growth_slab_size;
+			if (max_capacity > 0 && capacity + count > max_capacity) {
+				count = max_capacity > capacity ? max_capacity - capacity : 0;
+			}
+			if (count == 0) {
+				return false;
+			}
+			addSlab(count);
+			stats.recordGrowth();
+			return true;
+		}
+
+		// Takes one slot and builds the object in it. Without arguments a recycled
+		// object is handed back as is; with arguments a fresh object is always
+		// constructed, destroying a recycled one only when no empty slot is left.
+		template<typename... TArgs>
+		TType *take(TArgs&&... args) {
+			TType *ptr;
+			if constexpr (sizeof...(TArgs) == 0) {
+				if (!recycled.empty()) {
+					ptr = recycled.back();
+					recycled.pop_back();
+					return ptr;
+				}
+			}
+			if (free_slots.empty()) {
+				ptr = recycled.back();
+				ptr->~TType();
+				recycled.pop_back();
+				free_slots.push_back(ptr);
+			}
+			ptr = free_slots.back();
+			new(ptr) TType(std::forward<TArgs>(args)...);
+			free_slots.pop_back();
+
+			return ptr;
+		}
+
+		template<typename... TArgs>
+		Object construct(const typename Stats::Timer &timer, TArgs&&... args) {
+			TType *ptr = take(std::forward<TArgs>(args)...);
+			stats.recordAcquire(timer, capacity - getAvailable());
+
+			return Object(ptr, this);
+		}
+
+		bool ensureAvailable(size_t count = 1) {
+			while (getAvailable() < count) {
+				if (!grow()) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		// Called when an Object lets go of its slot
+		void release(TType *ptr) {
+			if (recycler) {
+				try {
+					recycler(*ptr);
+					recycled.push_back(ptr);
+					stats.recordRelease();
+					return;
+				} catch (...) {
+					// A failed reset falls back to destroying the object
+				}
+			}
+			ptr->~TType();
+			returnObject(ptr);
+		}
+
+		void destroyRecycled() {
+			for (TType *ptr : recycled) {
+				ptr->~TType();
+				free_slots.push_back(ptr);
+			}
+			recycled.clear();
+		}
 
 	public:
-		Pool(): capacity(0) {}
-		~Pool() = default;
+		Pool(): capacity(0), growth_slab_size(0), max_capacity(0) {}
+		~Pool() { destroyRecycled(); }
 
-		inline void returnObject(size_t index) {
-			free_indices.push_back(index);
+		Pool(const Pool &) = delete;
+		Pool &operator=(const Pool &) = delete;
+
+		// Objects point back at their pool, so only a pool with none in use can move
+		Pool(Pool &&other): Pool() { *this = std::move(other); }
+
+		Pool &operator=(Pool &&other) {
+			if (this != &other) {
+				if (other.getAvailable() != other.capacity || getAvailable() != capacity) {
+					throw std::runtime_error("Cannot move a Pool with objects in use");
+				}
+				destroyRecycled();
+				slabs = std::move(other.slabs);
+				free_slots = std::move(other.free_slots);
+				recycled = std::move(other.recycled);
+				recycler = std::move(other.recycler);
+				capacity = other.capacity;
+				growth_slab_size = other.growth_slab_size;
+				max_capacity = other.max_capacity;
+				stats = other.stats;
+
+				other.slabs.clear();
+				other.free_slots.clear();
+				other.recycled.clear();
+				other.recycler = nullptr;
+				other.capacity = 0;
+				other.growth_slab_size = 0;
+				other.max_capacity = 0;
+				other.stats = Stats();
+			}
+			return *this;
 		}
 
+		inline void returnObject(TType *ptr) {
+			free_slots.push_back(ptr);
+			stats.recordRelease();
+		}
+
+		// Grows the pool to `numberOfObjects` by adding a slab, live objects stay valid.
+		// Shrinking rebuilds the storage and is only allowed while no object is in use.
 		inline void resize(const size_t& numberOfObjects) {
-			storage = std::make_unique<std::byte[]>(numberOfObjects * sizeof(TType));
-			capacity = numberOfObjects;
+			if (numberOfObjects == capacity) {
+				return;
+			}
+			if (numberOfObjects > capacity) {
+				addSlab(numberOfObjects - capacity);
+				return;
+			}
+			if (getAvailable() != capacity) {
+				throw std::runtime_error("Cannot shrink a Pool with objects in use");
+			}
 
-			free_indices.clear();
-			free_indices.reserve(numberOfObjects);
-			for (size_t i = 0; i < numberOfObjects; ++i) {
-				free_indices.push_back(i);
+			destroyRecycled();
+			slabs.clear();
+			free_slots.clear();
+			capacity = 0;
+			if (numberOfObjects > 0) {
+				addSlab(numberOfObjects);
 			}
 		}
 
+		// Enables segmented growth: when empty, the pool adds a slab of `slabSize`
+		// objects, up to `maxCapacity` objects in total (0 means no limit)
+		inline void setGrowth(size_t slabSize, size_t maxCapacity = 0) {
+			growth_slab_size = slabSize;
+			max_capacity = maxCapacity;
+		}
+
+		// Enables recycling mode: released objects are not destroyed but passed to
+		// `reset` and kept alive (with whatever buffers they own) for the next
+		// argument-less acquire. Passing an empty function turns recycling off
+		// and destroys the objects kept so far.
+		inline void setRecycler(Recycler reset) {
+			recycler = std::move(reset);
+			if (!recycler) {
+				destroyRecycled();
+			}
+		}
+
+		// Destroys the recycled objects, releasing the memory they hold
+		inline void trim() { destroyRecycled(); }
+
+		size_t getCapacity() const { return capacity; }
+		size_t getAvailable() const { return free_slots.size() + recycled.size(); }
+		size_t getRecycled() const { return recycled.size(); }
+		size_t getSlabCount() const { return slabs.size(); }
+
+		// Counters are only filled in when the pool was built with a stats policy
+		PoolStatsSnapshot getStats() const {
+			PoolStatsSnapshot snapshot;
+			snapshot.live = capacity - getAvailable();
+			stats.fill(snapshot);
+			return snapshot;
+		}
+		void resetStats() { stats = Stats(); }
+
 		template<typename... TArgs>
 		Object acquire(TArgs&&... args) {
-			if (free_indices.empty()) {
+			typename Stats::Timer timer = stats.startAcquire();
+			if (!ensureAvailable()) {
+				stats.recordExhausted();
 				throw std::runtime_error("Pool is empty");
 			}
+			return construct(timer, std::forward<TArgs>(args)...);
+		}
 
-			size_t index = free_indices.back();
-			free_indices.pop_back();
+		// Non-throwing acquire: empty optional when the pool is exhausted and cannot grow
+		template<typename... TArgs>
+		std::optional<Object> tryAcquire(TArgs&&... args) {
+			typename Stats::Timer timer = stats.startAcquire();
+			if (!ensureAvailable()) {
+				stats.recordExhausted();
+				return std::nullopt;
+			}
+			return construct(timer, std::forward<TArgs>(args)...);
+		}
 
-			// Get pointer to the raw memory location
-			TType* ptr = reinterpret_cast<TType*>(storage.get() + index * sizeof(TType));
-			new(ptr) TType(std::forward<TArgs>(args)...);
+		// Acquires `count` objects at once, each built from copies of `args`.
+		// Growth happens up front and nothing is taken unless all of them fit.
+		template<typename... TArgs>
+		std::vector<Object> acquireBatch(size_t count, const TArgs&... args) {
+			typename Stats::Timer timer = stats.startAcquire();
+			if (!ensureAvailable(count)) {
+				stats.recordExhausted();
+				throw std::runtime_error("Pool is empty");
+			}
 
-			return Object(ptr, this, index);
+			std::vector<Object> batch;
+			batch.reserve(count);
+			for (size_t i = 0; i < count; ++i) {
+				batch.push_back(Object(take(args...), this));
+				stats.recordAcquire(timer, capacity - getAvailable());
+			}
+			return batch;
+		}
+
+		// Returns every object of the batch to the pool and leaves the batch empty
+		void releaseBatch(std::vector<Object> &batch) {
+			if (recycler) {
+				recycled.reserve(recycled.size() + batch.size());
+			} else {
+				free_slots.reserve(free_slots.size() + batch.size());
+			}
+			for (Object &object : batch) {
+				if (object.pool == this && object.ptr) {
+					release(object.ptr);
+					object.ptr = nullptr;
+					object.pool = nullptr;
+				}
+			}
+			batch.clear();
 		}
 };
 
 // Implementation after definition is needed for class interaction
-template <typename TType>
-inline Pool<TType>::Object::Object(TType *p, Pool<TType> *owner, size_t idx) 
-	: ptr(p), pool(owner), index(idx) {}
+template <typename TType, size_t SlotAlignment, typename Stats>
+inline Pool<TType, SlotAlignment, Stats>::Object::Object(TType *p, Pool *owner) 
+	: ptr(p), pool(owner) {}
 
-template <typename TType>
-inline Pool<TType>::Object::~Object() {
+template <typename TType, size_t SlotAlignment, typename Stats>
+inline Pool<TType, SlotAlignment, Stats>::Object::~Object() {
 	if (pool && ptr) {
-		ptr->~TType();
-		pool->returnObject(index);
+		pool->release(ptr);
 	}
 }
 
-template <typename TType>
-inline Pool<TType>::Object::Object(Object &&other) noexcept 
-	: ptr(other.ptr), pool(other.pool), index(other.index) {
+template <typename TType, size_t SlotAlignment, typename Stats>
+inline TType *Pool<TType, SlotAlignment, Stats>::Object::release() {
+	TType *released = ptr;
+	ptr = nullptr;
+	pool = nullptr;
+	return released;
+}
+
+template <typename TType, size_t SlotAlignment, typename Stats>
+inline Pool<TType, SlotAlignment, Stats>::Object::Object(Object &&other) noexcept 
+	: ptr(other.ptr), pool(other.pool) {
 	other.ptr = nullptr;
 	other.pool = nullptr;
 }
 
-template <typename TType>
-inline typename Pool<TType>::Object &Pool<TType>::Object::operator=(Object &&other) noexcept {
+template <typename TType, size_t SlotAlignment, typename Stats>
+inline typename Pool<TType, SlotAlignment, Stats>::Object &Pool<TType, SlotAlignment, Stats>::Object::operator=(Object &&other) noexcept {
 	if (this != &other) {
 		if (pool && ptr) {
-			ptr->~TType();
-			pool->returnObject(index);
+			pool->release(ptr);
 		}
 		
 		ptr = other.ptr;
 		pool = other.pool;
-		index = other.index;
 		
 		other.ptr = nullptr;
 		other.pool = nullptr;
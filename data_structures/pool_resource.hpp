@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pool_resource.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hmunoz-g <hmunoz-g@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:02:36 by hmunoz-g          #+#    #+#             */
+/*   Updated: 2026/10/18 17:02:36 by hmunoz-g         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef POOL_RESOURCE_HPP
+# define POOL_RESOURCE_HPP
+
+# include <cstddef>
+# include <memory_resource>
+# include <new>
+
+# include "pool.hpp"
+
+/*
+std::pmr::memory_resource handing out fixed-size blocks from a Pool
+
+Larger requests go to the upstream resource. Not synchronized.
+*/
+template <size_t BlockSize, size_t BlockAlignment = alignof(std::max_align_t)>
+class PoolResource : public std::pmr::memory_resource {
+	private:
+		struct alignas(BlockAlignment) Block {
+			// Left uninitialized: acquiring a block must not zero it
+			Block() {}
+
+			std::byte bytes[BlockSize];
+		};
+
+		Pool<Block> pool;
+		std::pmr::memory_resource *upstream;
+
+		static bool fits(size_t bytes, size_t alignment) {
+			return bytes <= sizeof(Block) && alignment <= alignof(Block);
+		}
+
+	protected:
+		void *do_allocate(size_t bytes, size_t alignment) override {
+			if (!fits(bytes, alignment)) {
+				return upstream->allocate(bytes, alignment);
+			}
+			auto block = pool.tryAcquire();
+			if (!block) {
+				throw std::bad_alloc();
+			}
+			return block->release();
+		}
+
+		void do_deallocate(void *ptr, size_t bytes, size_t alignment) override {
+			if (!fits(bytes, alignment)) {
+				upstream->deallocate(ptr, bytes, alignment);
+				return;
+			}
+			pool.returnObject(static_cast<Block*>(ptr));
+		}
+
+		bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+			return this == &other;
+		}
+
+	public:
+		// `blocks` are preallocated; a non-zero `growthSlab` lets the pool add more
+		explicit PoolResource(size_t blocks, size_t growthSlab = 0,
+			std::pmr::memory_resource *upstreamResource = std::pmr::get_default_resource())
+			: upstream(upstreamResource) {
+			pool.resize(blocks);
+			pool.setGrowth(growthSlab);
+		}
+
+		PoolResource(const PoolResource &) = delete;
+		PoolResource &operator=(const PoolResource &) = delete;
+
+		size_t getCapacity() const { return pool.getCapacity(); }
+		size_t getAvailable() const { return pool.getAvailable(); }
+		std::pmr::memory_resource *getUpstream() const { return upstream; }
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,110 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pool_stats.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hmunoz-g <hmunoz-g@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:05:13 by hmunoz-g          #+#    #+#             */
+/*   Updated: 2026/10/18 16:05:13 by hmunoz-g         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef POOL_STATS_HPP
+# define POOL_STATS_HPP
+
+# include <array>
+# include <chrono>
+# include <cstddef>
+# include <cstdint>
+
+// Point-in-time copy of a pool's counters, see Pool::getStats()
+struct PoolStatsSnapshot {
+	static constexpr size_t latencyBuckets = 32;
+
+	size_t live = 0;
+	size_t highWaterMark = 0;
+	uint64_t acquires = 0;
+	uint64_t releases = 0;
+	uint64_t exhaustions = 0;
+	uint64_t growths = 0;
+	// Bucket i counts acquires that took [2^i, 2^(i+1)) nanoseconds
+	std::array<uint64_t, latencyBuckets> acquireLatency = {};
+};
+
+/*
+Stats policies for Pool
+
+PoolNoStats compiles every hook away, PoolStats counts events and the
+high-water mark, PoolLatencyStats also times every acquire.
+*/
+struct PoolNoStats {
+	struct Timer {};
+
+	Timer startAcquire() const { return Timer(); }
+	void recordAcquire(const Timer &, size_t) {}
+	void recordRelease() {}
+	void recordExhausted() {}
+	void recordGrowth() {}
+	void fill(PoolStatsSnapshot &) const {}
+};
+
+template <bool MeasureLatency>
+struct BasicPoolStats {
+	using Clock = std::chrono::steady_clock;
+
+	struct Timer {
+		Clock::time_point start;
+	};
+
+	size_t high_water_mark = 0;
+	uint64_t acquires = 0;
+	uint64_t releases = 0;
+	uint64_t exhaustions = 0;
+	uint64_t growths = 0;
+	std::array<uint64_t, PoolStatsSnapshot::latencyBuckets> latency = {};
+
+	Timer startAcquire() const {
+		if constexpr (MeasureLatency) {
+			return Timer{Clock::now()};
+		} else {
+			return Timer();
+		}
+	}
+
+	void recordAcquire(const Timer &timer, size_t live) {
+		acquires++;
+		if (live > high_water_mark) {
+			high_water_mark = live;
+		}
+		if constexpr (MeasureLatency) {
+			uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - timer.start).count();
+			size_t bucket = 0;
+			while (ns > 1 && bucket + 1 < latency.size()) {
+				ns >>= 1;
+				bucket++;
+			}
+			latency[bucket]++;
+		} else {
+			(void)timer;
+		}
+	}
+
+	void recordRelease() { releases++; }
+	void recordExhausted() { exhaustions++; }
+	void recordGrowth() { growths++; }
+
+	void fill(PoolStatsSnapshot &snapshot) const {
+		snapshot.highWaterMark = high_water_mark;
+		snapshot.acquires = acquires;
+		snapshot.releases = releases;
+		snapshot.exhaustions = exhaustions;
+		snapshot.growths = growths;
+		snapshot.acquireLatency = latency;
+	}
+};
+
+using PoolStats = BasicPoolStats<false>;
+using PoolLatencyStats = BasicPoolStats<true>;
+
+#endif
\ No newline at end of file
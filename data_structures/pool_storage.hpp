@@ -0,0 +1,62 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pool_storage.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hmunoz-g <hmunoz-g@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:36:02 by hmunoz-g          #+#    #+#             */
+/*   Updated: 2026/10/19 11:36:02 by hmunoz-g         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef POOL_STORAGE_HPP
+# define POOL_STORAGE_HPP
+
+# include <cstddef>
+# include <memory>
+# include <new>
+
+// Size assumed for a cache line when padding data against false sharing
+constexpr size_t cacheLineSize = 64;
+
+// Smallest power of two not below `value` (1 for 0), used to size ring buffers
+constexpr size_t roundUpPowerOfTwo(size_t value) {
+	size_t rounded = 1;
+	while (rounded < value) {
+		rounded <<= 1;
+	}
+	return (rounded);
+}
+
+/*
+Slot geometry shared by the pools
+
+cacheLineSize as SlotAlignment gives each object its own cache line(s).
+*/
+template <typename TType, size_t SlotAlignment>
+struct PoolSlotLayout {
+	static_assert((SlotAlignment & (SlotAlignment - 1)) == 0, "Pool slot alignment must be a power of two");
+	static_assert(SlotAlignment >= alignof(TType), "Pool slot alignment cannot be weaker than alignof(TType)");
+
+	static constexpr size_t alignment = SlotAlignment;
+	static constexpr size_t stride = (sizeof(TType) + SlotAlignment - 1) & ~(SlotAlignment - 1);
+};
+
+// Raw, suitably aligned memory for a run of pool slots
+struct AlignedDeleter {
+	size_t alignment;
+
+	void operator()(std::byte *ptr) const {
+		::operator delete[](ptr, std::align_val_t(alignment));
+	}
+};
+
+using AlignedBytes = std::unique_ptr<std::byte[], AlignedDeleter>;
+
+inline AlignedBytes allocateAligned(size_t bytes, size_t alignment) {
+	void *raw = ::operator new[](bytes, std::align_val_t(alignment));
+	return AlignedBytes(static_cast<std::byte*>(raw), AlignedDeleter{alignment});
+}
+
+#endif
\ No newline at end of file
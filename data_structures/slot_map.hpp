@@ -0,0 +1,187 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   slot_map.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hmunoz-g <hmunoz-g@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:20:45 by hmunoz-g          #+#    #+#             */
+/*   Updated: 2026/10/19 14:20:45 by hmunoz-g         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SLOT_MAP_HPP
+# define SLOT_MAP_HPP
+
+# include <vector>
+# include <cstdint>
+# include <stdexcept>
+# include <utility>
+
+/*
+Generational handle pool (slot map)
+
+Stale handles are caught by the slot's generation. Objects are densely packed,
+so raw pointers are only valid until the next insert or release.
+*/
+template <typename TType, unsigned IndexBits = 20>
+class SlotMap {
+	static_assert(IndexBits > 0 && IndexBits < 32, "SlotMap needs room for both index and generation bits");
+
+	public:
+		class Handle {
+			private:
+				uint32_t value;
+
+				friend class SlotMap;
+				explicit Handle(uint32_t raw): value(raw) {}
+
+			public:
+				// Null handle, never valid
+				Handle(): value(0) {}
+
+				uint32_t raw() const { return value; }
+				bool isNull() const { return value == 0; }
+
+				bool operator==(const Handle &other) const { return value == other.value; }
+				bool operator!=(const Handle &other) const { return value != other.value; }
+		};
+
+	private:
+		static constexpr uint32_t indexMask = (1u << IndexBits) - 1;
+		static constexpr uint32_t maxGeneration = 0xFFFFFFFFu >> IndexBits;
+		static constexpr uint32_t noFreeSlot = 0xFFFFFFFFu;
+
+		struct Slot {
+			uint32_t dense_index;	// Position in `objects`, or next free slot while unused
+			uint32_t generation;	// Odd while live, even while free
+		};
+
+		std::vector<TType> objects;
+		std::vector<uint32_t> dense_to_slot;
+		std::vector<Slot> slots;
+		uint32_t free_head;
+
+		const Slot *resolve(Handle handle) const {
+			uint32_t index = handle.value & indexMask;
+			if (handle.isNull() || index >= slots.size()) {
+				return nullptr;
+			}
+			const Slot &slot = slots[index];
+			return (slot.generation == (handle.value >> IndexBits)) ? &slot : nullptr;
+		}
+
+		uint32_t allocateSlot() {
+			if (free_head != noFreeSlot) {
+				uint32_t index = free_head;
+				free_head = slots[index].dense_index;
+				return index;
+			}
+			if (slots.size() > indexMask) {
+				throw std::runtime_error("SlotMap is full");
+			}
+			// Starts free at generation 0, so a zero handle is always null
+			slots.push_back({0, 0});
+			return static_cast<uint32_t>(slots.size() - 1);
+		}
+
+	public:
+		using iterator = typename std::vector<TType>::iterator;
+		using const_iterator = typename std::vector<TType>::const_iterator;
+
+		SlotMap(): free_head(noFreeSlot) {}
+
+		void reserve(size_t count) {
+			objects.reserve(count);
+			dense_to_slot.reserve(count);
+			slots.reserve(count);
+		}
+
+		template<typename... TArgs>
+		Handle acquire(TArgs&&... args) {
+			uint32_t index = allocateSlot();
+			try {
+				objects.emplace_back(std::forward<TArgs>(args)...);
+				dense_to_slot.push_back(index);
+			} catch (...) {
+				if (objects.size() > dense_to_slot.size()) {
+					objects.pop_back();
+				}
+				slots[index].dense_index = free_head;
+				free_head = index;
+				throw;
+			}
+
+			Slot &slot = slots[index];
+			slot.generation++;
+			slot.dense_index = static_cast<uint32_t>(objects.size() - 1);
+			return Handle((slot.generation << IndexBits) | index);
+		}
+
+		// Destroys the object, returns false if the handle was already stale
+		bool release(Handle handle) {
+			const Slot *found = resolve(handle);
+			if (!found) {
+				return false;
+			}
+
+			uint32_t index = handle.value & indexMask;
+			uint32_t hole = found->dense_index;
+			uint32_t last = static_cast<uint32_t>(objects.size() - 1);
+
+			if (hole != last) {
+				objects[hole] = std::move(objects[last]);
+				dense_to_slot[hole] = dense_to_slot[last];
+				slots[dense_to_slot[hole]].dense_index = hole;
+			}
+			objects.pop_back();
+			dense_to_slot.pop_back();
+
+			Slot &slot = slots[index];
+			slot.generation++;
+			// A slot out of generations is retired, so old handles never match it again
+			if (slot.generation < maxGeneration) {
+				slot.dense_index = free_head;
+				free_head = index;
+			}
+
+			return true;
+		}
+
+		// O(1) lookup, nullptr when the handle is stale or null
+		TType *get(Handle handle) {
+			const Slot *slot = resolve(handle);
+			return slot ? &objects[slot->dense_index] : nullptr;
+		}
+
+		const TType *get(Handle handle) const {
+			const Slot *slot = resolve(handle);
+			return slot ? &objects[slot->dense_index] : nullptr;
+		}
+
+		TType &at(Handle handle) {
+			TType *object = get(handle);
+			if (!object) {
+				throw std::out_of_range("Stale SlotMap handle");
+			}
+			return *object;
+		}
+
+		bool contains(Handle handle) const { return resolve(handle) != nullptr; }
+		size_t size() const { return objects.size(); }
+		bool empty() const { return objects.empty(); }
+
+		// Handle of the object at a given position of the dense range
+		Handle handleAt(size_t denseIndex) const {
+			uint32_t index = dense_to_slot[denseIndex];
+			return Handle((slots[index].generation << IndexBits) | index);
+		}
+
+		// Iteration over live objects only, in dense (not acquisition) order
+		iterator begin() { return objects.begin(); }
+		iterator end() { return objects.end(); }
+		const_iterator begin() const { return objects.begin(); }
+		const_iterator end() const { return objects.end(); }
+};
+
+#endif
\ No newline at end of file
@@ -26,9 +26,11 @@ class Memento {
 			return snapshot;
 		}
 
+		// Snapshots share their storage, so this only takes a fresh read cursor
 		void load(const Snapshot &state) {
-			Snapshot mutable_state = state;
-			_loadFromSnapshot(mutable_state);
+			Snapshot reader = state;
+			reader.rewind();
+			_loadFromSnapshot(reader);
 		}
 	
 	private:
@@ -16,15 +16,20 @@
 # include <iostream>
 # include <map>
 # include <functional>
+# include <memory_resource>
 
 // Careful the TEvent passed MUST be comparable to work as a map key (i.e. support operator<)
+// Subscription nodes are allocated from the memory_resource given to the constructor
 // Observer with data catching capabilities
 template<typename TEvent, typename TData = void>
 class Observer {
 	private:
-		std::multimap<TEvent, std::function<void(const TData&)>> suscribers;
+		std::pmr::multimap<TEvent, std::function<void(const TData&)>> suscribers;
 
 	public:
+		Observer() = default;
+		explicit Observer(std::pmr::memory_resource *resource): suscribers(resource) {}
+
 		void subscribe(const TEvent &event, const std::function<void(const TData&)> &callback) {
 			suscribers.emplace(event, callback);
 		}
@@ -45,9 +50,12 @@ class Observer {
 template<typename TEvent>
 class Observer<TEvent, void> {
 private:
-	std::multimap<TEvent, std::function<void()>> subscribers;
+	std::pmr::multimap<TEvent, std::function<void()>> subscribers;
 
 public:
+	Observer() = default;
+	explicit Observer(std::pmr::memory_resource *resource): subscribers(resource) {}
+
 	void subscribe(const TEvent &event, const std::function<void()> &callback) {
 		subscribers.emplace(event, callback);
 	}
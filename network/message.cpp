@@ -23,19 +23,38 @@ Message &Message::operator<<(const std::string &str) {
 }
 
 Message &Message::operator>>(std::string &str) {
+	std::string_view view;
+	*this >> view;
+	str.assign(view.data(), view.size());
+	
+	return *this;
+}
+
+Message &Message::operator>>(std::string_view &str) {
 	uint32_t length;
 	*this >> length;
 	
-	if (_readPos + length > _data.size()) {
+	if (length > _data.size() - _readPos) {
 		throw std::runtime_error("Not enough data to read string");
 	}
 	
-	str.assign(reinterpret_cast<const char*>(&_data[_readPos]), length);
+	str = std::string_view(reinterpret_cast<const char*>(_data.data() + _readPos), length);
 	_readPos += length;
 	
 	return *this;
 }
 
+ByteSpan Message::readBytes(size_t size) {
+	if (size > _data.size() - _readPos) {
+		throw std::runtime_error("Message read past end");
+	}
+
+	ByteSpan span(_data.data() + _readPos, size);
+	_readPos += size;
+	
+	return span;
+}
+
 std::vector<uint8_t> Message::serialize() const {
 	std::vector<uint8_t> result;
 	
@@ -52,7 +71,7 @@ std::vector<uint8_t> Message::serialize() const {
 	return result;
 }
 
-Message Message::deserialize(const std::vector<uint8_t> &networkData) {
+Message Message::deserialize(const std::vector<uint8_t> &networkData, std::pmr::memory_resource *resource) {
 	if (networkData.size() < 8) { 
 		throw std::runtime_error("Invalid network data: too small");
 	}
@@ -73,7 +92,7 @@ Message Message::deserialize(const std::vector<uint8_t> &networkData) {
 		throw std::runtime_error("Invalid network data: size mismatch");
 	}
 	
-	Message result(messageType);
+	Message result(messageType, resource);
 	result._data.assign(networkData.begin() + pos, networkData.begin() + pos + dataSize);
 	
 	return result;
@@ -7,8 +7,12 @@
 # include <stdexcept>
 # include <cstddef>
 # include <cstring>
+# include <string_view>
+# include <memory_resource>
 # include <arpa/inet.h>
 
+# include "../data_structures/byte_span.hpp"
+
 class Message {
 public:
 	enum Type {
@@ -25,7 +29,9 @@ public:
 
 private:
 	int _messageType;
-	std::vector<uint8_t> _data;
+	// Payload bytes come from the memory_resource given at construction
+	// (e.g. a per-connection ArenaResource); copies use the default resource
+	std::pmr::vector<uint8_t> _data;
 	mutable size_t _readPos;
 
 	// Endianness conversion helpers
@@ -40,7 +46,8 @@ private:
 	}
 
 public:
-	explicit Message(int type): _messageType(type), _readPos(0) {}
+	explicit Message(int type, std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+		: _messageType(type), _data(resource), _readPos(0) {}
 	
 	int type() const { return _messageType; }
 
@@ -54,7 +61,7 @@ public:
 
 	template<typename T>
 	Message &operator>>(T &value) {
-		if (_readPos + sizeof(T) > _data.size()) {
+		if (sizeof(T) > _data.size() - _readPos) {
 			throw std::runtime_error("Message read past end");
 		}
 
@@ -69,6 +76,12 @@ public:
 	Message &operator<<(const std::string &str);
 	Message &operator>>(std::string &str);
 
+	// Zero-copy reads: the views point into the message payload and stay
+	// valid until the message is modified or destroyed
+	Message &operator>>(std::string_view &str);
+	ByteSpan readBytes(size_t size);
+	ByteSpan payload() const { return ByteSpan(_data.data(), _data.size()); }
+
 	// Raw data access for networking
 	const uint8_t *getData() const { return _data.data(); }
 	size_t getDataSize() const { return _data.size(); }
@@ -79,7 +92,8 @@ public:
 
 	// Serialization for network transmission
 	std::vector<uint8_t> serialize() const;
-	static Message deserialize(const std::vector<uint8_t> &networkData);
+	static Message deserialize(const std::vector<uint8_t> &networkData,
+		std::pmr::memory_resource *resource = std::pmr::get_default_resource());
 };
 
 // Template specializations for endianness
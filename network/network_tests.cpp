@@ -13,6 +13,7 @@
 #include <iostream>
 #include <thread>
 #include <chrono>
+#include <limits>
 
 #include "network.hpp"
 #include "../colors.h"
@@ -74,6 +75,41 @@ void testMessageTypes() {
 	std::cout << GRN << "Message types tests completed!" << RESET << std::endl;
 }
 
+void testMessageViews() {
+	std::cout << YEL << "\n=== Testing zero-copy Message reads ===" << RESET << std::endl;
+
+	Message msg(Message::DATA_TRANSFER);
+	msg << std::string("blob-name") << static_cast<uint32_t>(3);
+	msg << uint8_t(1) << uint8_t(2) << uint8_t(3);
+
+	std::string_view name;
+	uint32_t length;
+	msg >> name >> length;
+	ByteSpan bytes = msg.readBytes(length);
+
+	std::cout << "Viewed name: '" << name << "', " << bytes.size() << " raw bytes, last = "
+		<< static_cast<int>(bytes[bytes.size() - 1]) << std::endl;
+	std::cout << "Payload view size: " << msg.payload().size() << " bytes" << std::endl;
+
+	try {
+		msg.readBytes(1);
+	} catch (const std::exception &e) {
+		std::cout << "Caught exception: " << e.what() << std::endl;
+	}
+
+	// A size that wraps around when added to the read position
+	Message huge(Message::DATA_TRANSFER);
+	huge << uint8_t(1);
+	try {
+		huge.readBytes(std::numeric_limits<size_t>::max());
+		std::cout << RED << "readBytes(SIZE_MAX) did not throw" << RESET << std::endl;
+	} catch (const std::exception &e) {
+		std::cout << "Caught exception for readBytes(SIZE_MAX): " << e.what() << std::endl;
+	}
+
+	std::cout << GRN << "Message view tests completed!" << RESET << std::endl;
+}
+
 void testClientBasicFunctionality() {
 	std::cout << YEL << "\n=== Testing Client Basic Functionality ===" << RESET << std::endl;
 
@@ -370,6 +406,7 @@ int main(void) {
 
 	testMessage();
 	testMessageTypes();
+	testMessageViews();
 	testClientBasicFunctionality();
 	testClientConnectionFailure();
 	testClientMessageUpdate();
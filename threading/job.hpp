@@ -0,0 +1,150 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   job.hpp                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hmunoz-g <hmunoz-g@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:42:10 by hmunoz-g          #+#    #+#             */
+/*   Updated: 2026/10/18 16:42:10 by hmunoz-g         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef JOB_HPP
+# define JOB_HPP
+
+# include <cstddef>
+# include <functional>
+# include <new>
+# include <stdexcept>
+# include <type_traits>
+# include <utility>
+
+/*
+Move-only callable, the unit of work of WorkerPool
+
+Callables up to inlineSize bytes are stored in place, bigger ones on the heap.
+*/
+class Job {
+	public:
+		static constexpr size_t inlineSize = 64;
+
+		// Whether a callable of type TCallable is stored without allocating
+		template<typename TCallable>
+		static constexpr bool fitsInline = sizeof(TCallable) <= inlineSize
+			&& alignof(TCallable) <= alignof(std::max_align_t)
+			&& std::is_nothrow_move_constructible<TCallable>::value;
+
+	private:
+		// What the Job needs to know about the type it holds
+		struct Operations {
+			void (*invoke)(void *storage);
+			// Moves the callable from `source` into the empty `target` and destroys the source
+			void (*relocate)(void *source, void *target) noexcept;
+			void (*destroy)(void *storage) noexcept;
+		};
+
+		template<typename TCallable>
+		struct InlineOperations {
+			static TCallable &get(void *storage) { return *std::launder(static_cast<TCallable*>(storage)); }
+
+			static void invoke(void *storage) { get(storage)(); }
+			static void relocate(void *source, void *target) noexcept {
+				new(target) TCallable(std::move(get(source)));
+				get(source).~TCallable();
+			}
+			static void destroy(void *storage) noexcept { get(storage).~TCallable(); }
+
+			static constexpr Operations table = {invoke, relocate, destroy};
+		};
+
+		template<typename TCallable>
+		struct HeapOperations {
+			static TCallable *&get(void *storage) { return *std::launder(static_cast<TCallable**>(storage)); }
+
+			static void invoke(void *storage) { (*get(storage))(); }
+			static void relocate(void *source, void *target) noexcept {
+				new(target) TCallable*(get(source));
+			}
+			static void destroy(void *storage) noexcept { delete get(storage); }
+
+			static constexpr Operations table = {invoke, relocate, destroy};
+		};
+
+		alignas(std::max_align_t) unsigned char _storage[inlineSize];
+		const Operations *_operations;
+
+		// An empty std::function or a null function pointer gives an empty Job
+		template<typename TCallable>
+		static bool _isEmpty(const TCallable &) { return (false); }
+		template<typename TSignature>
+		static bool _isEmpty(const std::function<TSignature> &function) { return (!function); }
+		template<typename TFunction>
+		static bool _isEmpty(TFunction *function) { return (function == nullptr); }
+
+		void _reset() noexcept {
+			if (_operations) {
+				_operations->destroy(_storage);
+				_operations = nullptr;
+			}
+		}
+
+		void _take(Job &other) noexcept {
+			if (other._operations) {
+				other._operations->relocate(other._storage, _storage);
+				_operations = other._operations;
+				other._operations = nullptr;
+			}
+		}
+
+	public:
+		Job() noexcept: _operations(nullptr) {}
+		Job(std::nullptr_t) noexcept: _operations(nullptr) {}
+
+		template<typename TCallable, typename TDecayed = std::decay_t<TCallable>,
+			typename = std::enable_if_t<!std::is_same<TDecayed, Job>::value
+				&& std::is_invocable<TDecayed&>::value>>
+		Job(TCallable &&callable): _operations(nullptr) {
+			if (_isEmpty(callable)) {
+				return;
+			}
+			if constexpr (fitsInline<TDecayed>) {
+				new(_storage) TDecayed(std::forward<TCallable>(callable));
+				_operations = &InlineOperations<TDecayed>::table;
+			} else {
+				new(_storage) TDecayed*(new TDecayed(std::forward<TCallable>(callable)));
+				_operations = &HeapOperations<TDecayed>::table;
+			}
+		}
+
+		~Job() { _reset(); }
+
+		Job(Job &&other) noexcept: _operations(nullptr) { _take(other); }
+
+		Job &operator=(Job &&other) noexcept {
+			if (this != &other) {
+				_reset();
+				_take(other);
+			}
+			return (*this);
+		}
+
+		Job &operator=(std::nullptr_t) noexcept {
+			_reset();
+			return (*this);
+		}
+
+		Job(const Job &) = delete;
+		Job &operator=(const Job &) = delete;
+
+		void operator()() {
+			if (!_operations) {
+				throw std::bad_function_call();
+			}
+			_operations->invoke(_storage);
+		}
+
+		explicit operator bool() const noexcept { return (_operations != nullptr); }
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,308 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   job_future.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hmunoz-g <hmunoz-g@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 21:36:02 by hmunoz-g          #+#    #+#             */
+/*   Updated: 2026/10/18 21:36:02 by hmunoz-g         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef JOB_FUTURE_HPP
+# define JOB_FUTURE_HPP
+
+# include <atomic>
+# include <condition_variable>
+# include <exception>
+# include <functional>
+# include <memory>
+# include <mutex>
+# include <optional>
+# include <stdexcept>
+# include <type_traits>
+# include <utility>
+# include <vector>
+
+/*
+Shared state behind a JobFuture
+
+Continuations run on the thread that completes it, or at once if it already is.
+*/
+template<typename TType>
+class JobState {
+	public:
+		// void results only record completion
+		using Stored = std::conditional_t<std::is_void<TType>::value, bool, TType>;
+
+	private:
+		mutable std::mutex _mutex;
+		mutable std::condition_variable _readyCondition;
+		std::atomic<bool> _ready;
+		std::optional<Stored> _value;
+		std::exception_ptr _error;
+		std::vector<std::function<void()>> _continuations;
+
+		template<typename TStore>
+		void _complete(TStore store) {
+			std::vector<std::function<void()>> continuations;
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				if (_ready) {
+					throw std::logic_error("JobState already completed");
+				}
+				store();
+				_ready.store(true, std::memory_order_release);
+				continuations.swap(_continuations);
+			}
+			_readyCondition.notify_all();
+			for (auto &continuation : continuations) {
+				continuation();
+			}
+		}
+
+	public:
+		JobState(): _ready(false) {}
+		virtual ~JobState() = default;
+
+		JobState(const JobState &) = delete;
+		JobState &operator=(const JobState &) = delete;
+
+		template<typename... TValue>
+		void setValue(TValue&&... value) {
+			_complete([&]() {
+				if constexpr (std::is_void<TType>::value) {
+					_value.emplace(true);
+				} else {
+					_value.emplace(std::forward<TValue>(value)...);
+				}
+			});
+		}
+
+		void setError(std::exception_ptr error) {
+			_complete([&]() { _error = error; });
+		}
+
+		// Runs `continuation` once the state is complete
+		void onReady(std::function<void()> continuation) {
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				if (!_ready) {
+					_continuations.push_back(std::move(continuation));
+					return;
+				}
+			}
+			continuation();
+		}
+
+		bool isReady() const { return (_ready.load(std::memory_order_acquire)); }
+
+		void wait() const {
+			if (isReady()) {
+				return;
+			}
+			std::unique_lock<std::mutex> lock(_mutex);
+			_readyCondition.wait(lock, [this]() { return _ready.load(std::memory_order_relaxed); });
+		}
+
+		// Only valid once ready
+		std::exception_ptr error() const { return (_error); }
+		const Stored &value() const { return (*_value); }
+};
+
+/*
+Shared state and the job computing it, in one allocation
+
+A Runner destroyed without running completes the future with an error.
+*/
+template<typename TType, typename TCallable>
+class JobTask : public JobState<TType> {
+	private:
+		TCallable _callable;
+		std::atomic<bool> _started;
+
+	public:
+		class Runner {
+			private:
+				std::shared_ptr<JobTask> _task;
+
+			public:
+				explicit Runner(std::shared_ptr<JobTask> task): _task(std::move(task)) {}
+				Runner(Runner &&other) noexcept = default;
+				Runner(const Runner &) = delete;
+				Runner &operator=(const Runner &) = delete;
+				Runner &operator=(Runner &&) = delete;
+
+				~Runner() {
+					if (_task && !_task->_started) {
+						_task->setError(std::make_exception_ptr(std::runtime_error("Job dropped before it ran")));
+					}
+				}
+
+				void operator()() const { _task->run(); }
+		};
+
+		explicit JobTask(TCallable &&callable): _callable(std::move(callable)), _started(false) {}
+
+		void run() {
+			if (_started.exchange(true)) {
+				return;
+			}
+			try {
+				if constexpr (std::is_void<TType>::value) {
+					_callable();
+					this->setValue();
+				} else {
+					this->setValue(_callable());
+				}
+			} catch (...) {
+				this->setError(std::current_exception());
+			}
+		}
+};
+
+// Result of a then() continuation: it takes the result, or nothing after a void job
+template<typename TType, typename TCallable>
+struct JobContinuationResult {
+	using type = std::invoke_result_t<TCallable &, const TType &>;
+};
+
+template<typename TCallable>
+struct JobContinuationResult<void, TCallable> {
+	using type = std::invoke_result_t<TCallable &>;
+};
+
+/*
+Handle to the result of a job submitted with WorkerPool::submit()
+
+Copies share one result: get() blocks, then returns it or rethrows the job's
+exception. then() chains a continuation, when_all() joins many futures.
+*/
+template<typename TType>
+class JobFuture {
+	private:
+		std::shared_ptr<JobState<TType>> _state;
+
+		template<typename TResult, typename TCallable>
+		static void _fulfil(JobState<TResult> &target, TCallable &&callable) {
+			try {
+				if constexpr (std::is_void<TResult>::value) {
+					callable();
+					target.setValue();
+				} else {
+					target.setValue(callable());
+				}
+			} catch (...) {
+				target.setError(std::current_exception());
+			}
+		}
+
+	public:
+		JobFuture() = default;
+		explicit JobFuture(std::shared_ptr<JobState<TType>> state): _state(std::move(state)) {}
+
+		bool valid() const { return (_state != nullptr); }
+		bool isReady() const { return (_state && _state->isReady()); }
+
+		void wait() const {
+			if (!_state) {
+				throw std::logic_error("JobFuture has no state");
+			}
+			_state->wait();
+		}
+
+		// Runs `callback` once the job completed, successfully or not
+		void whenReady(std::function<void()> callback) const {
+			if (!_state) {
+				throw std::logic_error("JobFuture has no state");
+			}
+			_state->onReady(std::move(callback));
+		}
+
+		decltype(auto) get() const {
+			wait();
+			if (_state->error()) {
+				std::rethrow_exception(_state->error());
+			}
+			if constexpr (!std::is_void<TType>::value) {
+				return (static_cast<const TType &>(_state->value()));
+			}
+		}
+
+		template<typename TCallable>
+		auto then(TCallable &&callable) const {
+			using TResult = typename JobContinuationResult<TType, std::decay_t<TCallable>>::type;
+
+			if (!_state) {
+				throw std::logic_error("JobFuture has no state");
+			}
+			auto next = std::make_shared<JobState<TResult>>();
+			std::shared_ptr<JobState<TType>> source = _state;
+			_state->onReady([source, next, callable = std::forward<TCallable>(callable)]() mutable {
+				if (source->error()) {
+					next->setError(source->error());
+					return;
+				}
+				if constexpr (std::is_void<TType>::value) {
+					_fulfil(*next, [&]() { return callable(); });
+				} else {
+					_fulfil(*next, [&]() { return callable(source->value()); });
+				}
+			});
+			return (JobFuture<TResult>(next));
+		}
+};
+
+// Completes once every input has, with their results in input order, or with the
+// exception of the first failed input in input order (not the first to fail)
+template<typename TType>
+auto when_all(const std::vector<JobFuture<TType>> &futures) {
+	using TResult = std::conditional_t<std::is_void<TType>::value, void, std::vector<TType>>;
+
+	struct Join {
+		std::shared_ptr<JobState<TResult>> state = std::make_shared<JobState<TResult>>();
+		std::atomic<size_t> remaining;
+		std::vector<JobFuture<TType>> inputs;
+	};
+
+	auto join = std::make_shared<Join>();
+	join->remaining = futures.size();
+	join->inputs = futures;
+	JobFuture<TResult> result(join->state);
+
+	auto finish = [join]() {
+		try {
+			if constexpr (std::is_void<TType>::value) {
+				for (const auto &input : join->inputs) {
+					input.get();
+				}
+				join->state->setValue();
+			} else {
+				std::vector<TType> values;
+				values.reserve(join->inputs.size());
+				for (const auto &input : join->inputs) {
+					values.push_back(input.get());
+				}
+				join->state->setValue(std::move(values));
+			}
+		} catch (...) {
+			join->state->setError(std::current_exception());
+		}
+	};
+
+	if (futures.empty()) {
+		finish();
+		return (result);
+	}
+	for (const auto &future : futures) {
+		future.whenReady([join, finish]() {
+			if (--join->remaining == 0) {
+				finish();
+			}
+		});
+	}
+	return (result);
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,149 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mpmc_queue.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hmunoz-g <hmunoz-g@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:21:07 by hmunoz-g          #+#    #+#             */
+/*   Updated: 2026/10/18 18:21:07 by hmunoz-g         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MPMC_QUEUE_HPP
+# define MPMC_QUEUE_HPP
+
+# include <atomic>
+# include <cstddef>
+# include <cstdint>
+# include <memory>
+# include <new>
+# include <optional>
+# include <stdexcept>
+# include <thread>
+# include <type_traits>
+# include <utility>
+
+# include "../data_structures/pool_storage.hpp"
+
+/*
+Bounded lock-free multi-producer/multi-consumer FIFO queue
+
+try_push() fails when the queue is full, push_back() yields until there is room.
+*/
+template<typename TType>
+class MPMCQueue {
+	static_assert(std::is_nothrow_move_constructible<TType>::value, "MPMCQueue elements must be nothrow move constructible");
+
+	private:
+		struct Slot {
+			std::atomic<size_t> sequence;
+			alignas(TType) unsigned char storage[sizeof(TType)];
+
+			TType *value() { return std::launder(reinterpret_cast<TType*>(storage)); }
+		};
+
+		std::unique_ptr<Slot[]> _slots;
+		size_t _mask;
+		alignas(cacheLineSize) std::atomic<size_t> _tail;
+		alignas(cacheLineSize) std::atomic<size_t> _head;
+		char _padding[cacheLineSize - sizeof(std::atomic<size_t>)];
+
+		// A claimed slot must always be published, so a constructor that may throw
+		// runs before the claim and the value is then moved in
+		template<typename... TArgs>
+		bool _tryEmplace(TArgs&&... args) {
+			if constexpr (!std::is_nothrow_constructible<TType, TArgs&&...>::value) {
+				TType value(std::forward<TArgs>(args)...);
+				return (_tryEmplace(std::move(value)));
+			}
+			size_t position = _tail.load(std::memory_order_relaxed);
+			while (true) {
+				Slot &slot = _slots[position & _mask];
+				size_t sequence = slot.sequence.load(std::memory_order_acquire);
+				intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+				if (diff == 0) {
+					if (_tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+						new(slot.storage) TType(std::forward<TArgs>(args)...);
+						slot.sequence.store(position + 1, std::memory_order_release);
+						return (true);
+					}
+				} else if (diff < 0) {
+					// The slot still holds the value from one lap ago: full
+					return (false);
+				} else {
+					position = _tail.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+	public:
+		explicit MPMCQueue(size_t capacity)
+			: _slots(new Slot[roundUpPowerOfTwo(capacity)]),
+			  _mask(roundUpPowerOfTwo(capacity) - 1), _tail(0), _head(0) {
+			for (size_t i = 0; i <= _mask; ++i) {
+				_slots[i].sequence.store(i, std::memory_order_relaxed);
+			}
+		}
+
+		~MPMCQueue() {
+			while (try_pop()) {}
+		}
+
+		MPMCQueue(const MPMCQueue &) = delete;
+		MPMCQueue &operator=(const MPMCQueue &) = delete;
+
+		bool try_push(const TType &element) { return (_tryEmplace(element)); }
+		bool try_push(TType &&element) { return (_tryEmplace(std::move(element))); }
+
+		// Spins (yielding) while the queue is full
+		void push_back(const TType &element) {
+			while (!_tryEmplace(element)) {
+				std::this_thread::yield();
+			}
+		}
+
+		std::optional<TType> try_pop() {
+			size_t position = _head.load(std::memory_order_relaxed);
+			while (true) {
+				Slot &slot = _slots[position & _mask];
+				size_t sequence = slot.sequence.load(std::memory_order_acquire);
+				intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+
+				if (diff == 0) {
+					if (_head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+						std::optional<TType> value(std::move(*slot.value()));
+						slot.value()->~TType();
+						// Hand the slot to the producer of the next lap
+						slot.sequence.store(position + _mask + 1, std::memory_order_release);
+						return (value);
+					}
+				} else if (diff < 0) {
+					return (std::nullopt);
+				} else {
+					position = _head.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		TType pop_front() {
+			std::optional<TType> value = try_pop();
+			if (!value) {
+				throw std::runtime_error("Queue is empty");
+			}
+			return (std::move(*value));
+		}
+
+		// Utility, only a snapshot while other threads are pushing or popping
+		size_t size() const {
+			size_t tail = _tail.load(std::memory_order_acquire);
+			size_t head = _head.load(std::memory_order_acquire);
+			return (tail > head ? tail - head : 0);
+		}
+
+		bool empty() const { return (size() == 0); }
+		size_t capacity() const { return (_mask + 1); }
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,233 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parallel_algorithms.hpp                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hmunoz-g <hmunoz-g@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 22:28:49 by hmunoz-g          #+#    #+#             */
+/*   Updated: 2026/10/18 22:28:49 by hmunoz-g         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PARALLEL_ALGORITHMS_HPP
+# define PARALLEL_ALGORITHMS_HPP
+
+# include <algorithm>
+# include <atomic>
+# include <condition_variable>
+# include <cstddef>
+# include <exception>
+# include <functional>
+# include <iterator>
+# include <memory>
+# include <mutex>
+# include <utility>
+# include <vector>
+
+# include "worker_pool.hpp"
+
+/*
+Data-parallel algorithms on a WorkerPool
+
+The calling thread works through chunks too, so they can be called from a
+pool job. The first exception a chunk threw is rethrown.
+*/
+class ParallelLoop {
+	private:
+		using Body = void (*)(const void *context, size_t chunk, size_t begin, size_t end);
+
+		size_t _begin;
+		size_t _end;
+		size_t _grain;
+		size_t _chunks;
+		Body _body;
+		const void *_context;
+
+		std::atomic<size_t> _next;
+		std::atomic<size_t> _finished;
+		std::atomic<bool> _failed;
+		std::exception_ptr _error;
+		std::mutex _mutex;
+		std::condition_variable _done;
+
+	public:
+		ParallelLoop(size_t begin, size_t end, size_t grain, Body body, const void *context)
+			: _begin(begin), _end(end), _grain(grain), _chunks((end - begin + grain - 1) / grain),
+			  _body(body), _context(context), _next(0), _finished(0), _failed(false) {}
+
+		size_t chunks() const { return _chunks; }
+
+		// Claims and runs chunks until none are left
+		void work() {
+			size_t chunk;
+			while ((chunk = _next.fetch_add(1)) < _chunks) {
+				if (!_failed) {
+					size_t begin = _begin + chunk * _grain;
+					size_t end = std::min(begin + _grain, _end);
+					try {
+						_body(_context, chunk, begin, end);
+					} catch (...) {
+						std::lock_guard<std::mutex> lock(_mutex);
+						if (!_error) {
+							_error = std::current_exception();
+						}
+						_failed = true;
+					}
+				}
+				if (_finished.fetch_add(1) + 1 == _chunks) {
+					std::lock_guard<std::mutex> lock(_mutex);
+					_done.notify_all();
+				}
+			}
+		}
+
+		void wait() {
+			std::unique_lock<std::mutex> lock(_mutex);
+			_done.wait(lock, [this]() { return _finished.load() == _chunks; });
+			if (_error) {
+				std::rethrow_exception(_error);
+			}
+		}
+};
+
+inline size_t parallelGrain(const WorkerPool &pool, size_t count, size_t grain) {
+	if (grain > 0) {
+		return grain;
+	}
+	size_t threads = pool.getWorkerCount() + 1;
+	size_t automatic = count / (threads * 8);
+	return automatic > 0 ? automatic : 1;
+}
+
+// Calls chunkBody(chunkIndex, begin, end) for every chunk of [begin, end)
+template<typename TChunkBody>
+void parallel_chunks(WorkerPool &pool, size_t begin, size_t end, const TChunkBody &chunkBody, size_t grain = 0) {
+	if (begin >= end) {
+		return;
+	}
+	grain = parallelGrain(pool, end - begin, grain);
+
+	auto loop = std::make_shared<ParallelLoop>(begin, end, grain,
+		[](const void *context, size_t chunk, size_t first, size_t last) {
+			(*static_cast<const TChunkBody *>(context))(chunk, first, last);
+		}, &chunkBody);
+
+	// Helpers that start after the last chunk was claimed just return
+	size_t helpers = std::min(pool.getWorkerCount(), loop->chunks() - 1);
+	for (size_t i = 0; i < helpers; ++i) {
+		pool.addJob([loop]() { loop->work(); });
+	}
+	loop->work();
+	loop->wait();
+}
+
+// Calls body(i) for every i in [begin, end)
+template<typename TBody>
+void parallel_for(WorkerPool &pool, size_t begin, size_t end, const TBody &body, size_t grain = 0) {
+	parallel_chunks(pool, begin, end, [&body](size_t, size_t first, size_t last) {
+		for (size_t i = first; i < last; ++i) {
+			body(i);
+		}
+	}, grain);
+}
+
+// Folds map(i) over [begin, end) with the associative `reduce`; chunk results
+// are combined in index order, so `reduce` need not be commutative
+template<typename TValue, typename TMap, typename TReduce>
+TValue parallel_reduce(WorkerPool &pool, size_t begin, size_t end, TValue identity,
+	const TMap &map, const TReduce &reduce, size_t grain = 0) {
+	if (begin >= end) {
+		return identity;
+	}
+	grain = parallelGrain(pool, end - begin, grain);
+	std::vector<TValue> partials((end - begin + grain - 1) / grain, identity);
+
+	parallel_chunks(pool, begin, end, [&](size_t chunk, size_t first, size_t last) {
+		TValue accumulator = identity;
+		for (size_t i = first; i < last; ++i) {
+			accumulator = reduce(std::move(accumulator), map(i));
+		}
+		partials[chunk] = std::move(accumulator);
+	}, grain);
+
+	TValue result = std::move(identity);
+	for (TValue &partial : partials) {
+		result = reduce(std::move(result), std::move(partial));
+	}
+	return result;
+}
+
+// out[i] = op(first[i]) for every element, with random access iterators
+template<typename TInputIt, typename TOutputIt, typename TOperation>
+TOutputIt parallel_transform(WorkerPool &pool, TInputIt first, TInputIt last, TOutputIt out,
+	const TOperation &operation, size_t grain = 0) {
+	size_t count = static_cast<size_t>(std::distance(first, last));
+	parallel_chunks(pool, 0, count, [&](size_t, size_t begin, size_t end) {
+		std::transform(first + begin, first + end, out + begin, operation);
+	}, grain);
+	return out + count;
+}
+
+// Stable parallel merge sort: parallel chunk sorts, then pairwise merge rounds
+template<typename TRandomIt, typename TCompare = std::less<>>
+void parallel_sort(WorkerPool &pool, TRandomIt first, TRandomIt last, TCompare compare = TCompare(), size_t grain = 0) {
+	using TValue = typename std::iterator_traits<TRandomIt>::value_type;
+
+	size_t count = static_cast<size_t>(std::distance(first, last));
+	if (count < 2) {
+		return;
+	}
+	grain = std::max<size_t>(parallelGrain(pool, count, grain), 256);
+
+	std::vector<size_t> runs;
+	for (size_t begin = 0; begin < count; begin += grain) {
+		runs.push_back(begin);
+	}
+	runs.push_back(count);
+
+	parallel_chunks(pool, 0, count, [&](size_t, size_t begin, size_t end) {
+		std::stable_sort(first + begin, first + end, compare);
+	}, grain);
+	if (runs.size() <= 2) {
+		return;
+	}
+
+	std::vector<TValue> scratch(std::make_move_iterator(first), std::make_move_iterator(last));
+	bool inScratch = true;
+
+	while (runs.size() > 2) {
+		size_t runCount = runs.size() - 1;
+		size_t pairs = (runCount + 1) / 2;
+		std::vector<size_t> merged;
+		for (size_t pair = 0; pair < pairs; ++pair) {
+			merged.push_back(runs[pair * 2]);
+		}
+		merged.push_back(count);
+
+		parallel_for(pool, 0, pairs, [&](size_t pair) {
+			size_t begin = runs[pair * 2];
+			size_t middle = runs[pair * 2 + 1];
+			// An odd run out is merged with nothing, i.e. moved across
+			size_t end = runs[std::min(pair * 2 + 2, runCount)];
+			if (inScratch) {
+				std::merge(std::make_move_iterator(scratch.begin() + begin), std::make_move_iterator(scratch.begin() + middle),
+					std::make_move_iterator(scratch.begin() + middle), std::make_move_iterator(scratch.begin() + end),
+					first + begin, compare);
+			} else {
+				std::merge(std::make_move_iterator(first + begin), std::make_move_iterator(first + middle),
+					std::make_move_iterator(first + middle), std::make_move_iterator(first + end),
+					scratch.begin() + begin, compare);
+			}
+		}, 1);
+
+		runs.swap(merged);
+		inScratch = !inScratch;
+	}
+
+	if (inScratch) {
+		std::move(scratch.begin(), scratch.end(), first);
+	}
+}
+
+#endif
\ No newline at end of file
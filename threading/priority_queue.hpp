@@ -0,0 +1,250 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   priority_queue.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hmunoz-g <hmunoz-g@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:03:41 by hmunoz-g          #+#    #+#             */
+/*   Updated: 2026/10/18 20:03:41 by hmunoz-g         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PRIORITY_QUEUE_HPP
+# define PRIORITY_QUEUE_HPP
+
+# include <atomic>
+# include <chrono>
+# include <condition_variable>
+# include <cstdint>
+# include <mutex>
+# include <new>
+# include <optional>
+# include <stdexcept>
+# include <type_traits>
+# include <utility>
+# include <vector>
+
+# include "../data_structures/pool_storage.hpp"
+
+/*
+Thread-safe priority queue built from one FIFO lane per priority level
+
+Level 0 is the most urgent, and elements of the same priority keep their push
+order. Up to 64 levels are supported.
+*/
+template<typename TType>
+class ConcurrentPriorityQueue {
+	static_assert(std::is_nothrow_move_constructible<TType>::value,
+		"ConcurrentPriorityQueue elements must be nothrow move constructible");
+
+	private:
+		class Lane {
+			private:
+				AlignedBytes _storage;
+				size_t _capacity;
+				size_t _head;
+				size_t _count;
+
+				TType *_at(size_t index) const {
+					size_t slot = (_head + index) & (_capacity - 1);
+					return (reinterpret_cast<TType*>(_storage.get() + slot * sizeof(TType)));
+				}
+
+			public:
+				Lane(): _storage(nullptr, AlignedDeleter{alignof(TType)}), _capacity(0), _head(0), _count(0) {}
+				~Lane() { clear(); }
+
+				Lane(const Lane &) = delete;
+				Lane &operator=(const Lane &) = delete;
+
+				// Moves the elements to a ring of roundUpPowerOfTwo(capacity) slots
+				void reserve(size_t capacity) {
+					if (capacity <= _capacity) {
+						return;
+					}
+					capacity = roundUpPowerOfTwo(capacity);
+					AlignedBytes bigger = allocateAligned(capacity * sizeof(TType), alignof(TType));
+					for (size_t i = 0; i < _count; ++i) {
+						new(bigger.get() + i * sizeof(TType)) TType(std::move(*_at(i)));
+						_at(i)->~TType();
+					}
+					_storage = std::move(bigger);
+					_capacity = capacity;
+					_head = 0;
+				}
+
+				template<typename... TArgs>
+				void emplace_back(TArgs&&... args) {
+					if (_count == _capacity) {
+						reserve(_capacity > 0 ? _capacity * 2 : 16);
+					}
+					new(_at(_count)) TType(std::forward<TArgs>(args)...);
+					_count++;
+				}
+
+				TType &front() { return (*std::launder(_at(0))); }
+
+				void pop_front() {
+					std::launder(_at(0))->~TType();
+					_head = (_head + 1) & (_capacity - 1);
+					_count--;
+				}
+
+				bool empty() const { return (_count == 0); }
+				size_t size() const { return (_count); }
+
+				void clear() {
+					while (_count > 0) {
+						pop_front();
+					}
+				}
+		};
+
+		std::vector<Lane> _lanes;
+		uint64_t _nonEmpty;
+		// Copy of _nonEmpty readable without the lock
+		std::atomic<uint64_t> _nonEmptyHint;
+		size_t _size;
+		mutable std::mutex _mutex;
+		std::condition_variable _notEmpty;
+		bool _closed;
+
+		// Caller holds the lock and has checked the queue is not empty
+		TType _takeFront() {
+			size_t level = static_cast<size_t>(__builtin_ctzll(_nonEmpty));
+			Lane &lane = _lanes[level];
+			TType value = std::move(lane.front());
+			lane.pop_front();
+			if (lane.empty()) {
+				_nonEmpty &= ~(uint64_t(1) << level);
+				_nonEmptyHint.store(_nonEmpty, std::memory_order_relaxed);
+			}
+			_size--;
+			return (value);
+		}
+
+		static size_t _checkLevels(size_t levels) {
+			if (levels == 0 || levels > 64) {
+				throw std::invalid_argument("ConcurrentPriorityQueue supports 1 to 64 priority levels");
+			}
+			return (levels);
+		}
+
+		template<typename... TArgs>
+		bool _push(size_t priority, TArgs&&... args) {
+			if (priority >= _lanes.size()) {
+				throw std::out_of_range("Priority out of range");
+			}
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				if (_closed) {
+					return (false);
+				}
+				_lanes[priority].emplace_back(std::forward<TArgs>(args)...);
+				_nonEmpty |= uint64_t(1) << priority;
+				_nonEmptyHint.store(_nonEmpty, std::memory_order_relaxed);
+				_size++;
+			}
+			_notEmpty.notify_one();
+			return (true);
+		}
+
+	public:
+		explicit ConcurrentPriorityQueue(size_t levels = 2, size_t laneCapacity = 0)
+			: _lanes(_checkLevels(levels)), _nonEmpty(0), _nonEmptyHint(0), _size(0), _closed(false) {
+			for (Lane &lane : _lanes) {
+				lane.reserve(laneCapacity);
+			}
+		}
+
+		ConcurrentPriorityQueue(const ConcurrentPriorityQueue &) = delete;
+		ConcurrentPriorityQueue &operator=(const ConcurrentPriorityQueue &) = delete;
+
+		// Pushes return false once the queue is closed, throw on an unknown priority
+		bool push(const TType &element, size_t priority) { return (_push(priority, element)); }
+		bool push(TType &&element, size_t priority) { return (_push(priority, std::move(element))); }
+
+		template<typename... TArgs>
+		bool emplace(size_t priority, TArgs&&... args) {
+			return (_push(priority, std::forward<TArgs>(args)...));
+		}
+
+		TType pop_front() {
+			std::lock_guard<std::mutex> lock(_mutex);
+			if (_size == 0) {
+				throw std::runtime_error(_closed ? "Queue is closed" : "Queue is empty");
+			}
+			return (_takeFront());
+		}
+
+		std::optional<TType> try_pop() {
+			std::lock_guard<std::mutex> lock(_mutex);
+			if (_size == 0) {
+				return (std::nullopt);
+			}
+			return (_takeFront());
+		}
+
+		// Empty optional only once the queue is closed and drained
+		std::optional<TType> wait_pop() {
+			std::unique_lock<std::mutex> lock(_mutex);
+			_notEmpty.wait(lock, [this]() { return _size > 0 || _closed; });
+			if (_size == 0) {
+				return (std::nullopt);
+			}
+			return (_takeFront());
+		}
+
+		template<typename Rep, typename Period>
+		std::optional<TType> wait_pop_for(const std::chrono::duration<Rep, Period> &timeout) {
+			std::unique_lock<std::mutex> lock(_mutex);
+			if (!_notEmpty.wait_for(lock, timeout, [this]() { return _size > 0 || _closed; }) || _size == 0) {
+				return (std::nullopt);
+			}
+			return (_takeFront());
+		}
+
+		void close() {
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				_closed = true;
+			}
+			_notEmpty.notify_all();
+		}
+
+		bool isClosed() const {
+			std::lock_guard<std::mutex> lock(_mutex);
+			return (_closed);
+		}
+
+		// Utility
+		size_t levels() const { return (_lanes.size()); }
+
+		// Bit i set when lane i looked non-empty; lock-free, so only a hint
+		uint64_t nonEmptyLanes() const { return (_nonEmptyHint.load(std::memory_order_relaxed)); }
+
+		size_t size() const {
+			std::lock_guard<std::mutex> lock(_mutex);
+			return (_size);
+		}
+
+		size_t size(size_t priority) const {
+			std::lock_guard<std::mutex> lock(_mutex);
+			return (_lanes.at(priority).size());
+		}
+
+		bool empty() const { return (size() == 0); }
+
+		void clear() {
+			std::lock_guard<std::mutex> lock(_mutex);
+			for (auto &lane : _lanes) {
+				lane.clear();
+			}
+			_nonEmpty = 0;
+			_nonEmptyHint.store(0, std::memory_order_relaxed);
+			_size = 0;
+		}
+};
+
+#endif
\ No newline at end of file
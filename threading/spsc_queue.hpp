@@ -0,0 +1,170 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   spsc_queue.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hmunoz-g <hmunoz-g@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:54:30 by hmunoz-g          #+#    #+#             */
+/*   Updated: 2026/10/18 18:54:30 by hmunoz-g         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SPSC_QUEUE_HPP
+# define SPSC_QUEUE_HPP
+
+# include <atomic>
+# include <cstddef>
+# include <memory>
+# include <new>
+# include <optional>
+# include <stdexcept>
+# include <thread>
+# include <utility>
+
+# include "../data_structures/pool_storage.hpp"
+
+/*
+Wait-free single-producer/single-consumer FIFO ring
+
+Exactly one thread may push and exactly one thread may pop.
+*/
+template<typename TType>
+class SPSCQueue {
+	private:
+		struct Slot {
+			alignas(TType) unsigned char storage[sizeof(TType)];
+
+			TType *value() { return std::launder(reinterpret_cast<TType*>(storage)); }
+		};
+
+		std::unique_ptr<Slot[]> _slots;
+		size_t _mask;
+
+		// Producer side
+		alignas(cacheLineSize) std::atomic<size_t> _tail;
+		size_t _cachedHead;
+
+		// Consumer side
+		alignas(cacheLineSize) std::atomic<size_t> _head;
+		size_t _cachedTail;
+		char _padding[cacheLineSize - sizeof(std::atomic<size_t>) - sizeof(size_t)];
+
+		// Free slots as seen by the producer, refreshing the cached head only when needed
+		size_t _writable(size_t tail, size_t wanted) {
+			size_t space = capacity() - (tail - _cachedHead);
+			if (space < wanted) {
+				_cachedHead = _head.load(std::memory_order_acquire);
+				space = capacity() - (tail - _cachedHead);
+			}
+			return (space);
+		}
+
+		// Filled slots as seen by the consumer
+		size_t _readable(size_t head, size_t wanted) {
+			size_t filled = _cachedTail - head;
+			if (filled < wanted) {
+				_cachedTail = _tail.load(std::memory_order_acquire);
+				filled = _cachedTail - head;
+			}
+			return (filled);
+		}
+
+		template<typename TValue>
+		bool _tryPush(TValue &&element) {
+			size_t tail = _tail.load(std::memory_order_relaxed);
+			if (_writable(tail, 1) == 0) {
+				return (false);
+			}
+			new(_slots[tail & _mask].storage) TType(std::forward<TValue>(element));
+			_tail.store(tail + 1, std::memory_order_release);
+			return (true);
+		}
+
+	public:
+		explicit SPSCQueue(size_t capacity)
+			: _slots(new Slot[roundUpPowerOfTwo(capacity)]),
+			  _mask(roundUpPowerOfTwo(capacity) - 1),
+			  _tail(0), _cachedHead(0), _head(0), _cachedTail(0) {}
+
+		~SPSCQueue() {
+			while (try_pop()) {}
+		}
+
+		SPSCQueue(const SPSCQueue &) = delete;
+		SPSCQueue &operator=(const SPSCQueue &) = delete;
+
+		// Producer
+		bool try_push(const TType &element) { return (_tryPush(element)); }
+		bool try_push(TType &&element) { return (_tryPush(std::move(element))); }
+
+		void push_back(const TType &element) {
+			while (!_tryPush(element)) {
+				std::this_thread::yield();
+			}
+		}
+
+		// Copies up to `count` elements, returns how many fitted
+		size_t write(const TType *elements, size_t count) {
+			size_t tail = _tail.load(std::memory_order_relaxed);
+			size_t space = _writable(tail, count);
+			size_t written = count < space ? count : space;
+			size_t i = 0;
+			try {
+				for (; i < written; ++i) {
+					new(_slots[(tail + i) & _mask].storage) TType(elements[i]);
+				}
+			} catch (...) {
+				// Publishes the copies already made, the failed slot stays free
+				_tail.store(tail + i, std::memory_order_release);
+				throw;
+			}
+			_tail.store(tail + written, std::memory_order_release);
+			return (written);
+		}
+
+		// Consumer
+		std::optional<TType> try_pop() {
+			size_t head = _head.load(std::memory_order_relaxed);
+			if (_readable(head, 1) == 0) {
+				return (std::nullopt);
+			}
+			TType *slot = _slots[head & _mask].value();
+			std::optional<TType> value(std::move(*slot));
+			slot->~TType();
+			_head.store(head + 1, std::memory_order_release);
+			return (value);
+		}
+
+		TType pop_front() {
+			std::optional<TType> value = try_pop();
+			if (!value) {
+				throw std::runtime_error("Queue is empty");
+			}
+			return (std::move(*value));
+		}
+
+		// Moves up to `count` elements into `out`, returns how many were read
+		size_t read(TType *out, size_t count) {
+			size_t head = _head.load(std::memory_order_relaxed);
+			size_t filled = _readable(head, count);
+			size_t taken = count < filled ? count : filled;
+			for (size_t i = 0; i < taken; ++i) {
+				TType *slot = _slots[(head + i) & _mask].value();
+				out[i] = std::move(*slot);
+				slot->~TType();
+			}
+			_head.store(head + taken, std::memory_order_release);
+			return (taken);
+		}
+
+		// Utility, exact only when called from the producer or the consumer thread
+		size_t size() const {
+			return (_tail.load(std::memory_order_acquire) - _head.load(std::memory_order_acquire));
+		}
+
+		bool empty() const { return (size() == 0); }
+		size_t capacity() const { return (_mask + 1); }
+};
+
+#endif
\ No newline at end of file
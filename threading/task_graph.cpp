@@ -0,0 +1,218 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   task_graph.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hmunoz-g <hmunoz-g@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:12:20 by hmunoz-g          #+#    #+#             */
+/*   Updated: 2026/10/18 23:12:20 by hmunoz-g         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "task_graph.hpp"
+
+#include <chrono>
+#include <stdexcept>
+
+TaskGraph::TaskGraph()
+	: _validated(true), _pool(nullptr), _running(false), _remaining(0), _finished(true) {}
+
+TaskGraph::Node &TaskGraph::_node(TaskId id) {
+	if (id >= _nodes.size()) {
+		throw std::out_of_range("Unknown TaskGraph task");
+	}
+	return _nodes[id];
+}
+
+TaskGraph::TaskId TaskGraph::addTask(std::function<void()> work, const std::string &name) {
+	if (_running) {
+		throw std::logic_error("Cannot modify a running TaskGraph");
+	}
+	_nodes.emplace_back();
+	_nodes.back().work = std::move(work);
+	_nodes.back().name = name;
+	_nodes.back().index = _nodes.size() - 1;
+	_validated = false;
+
+	return _nodes.size() - 1;
+}
+
+void TaskGraph::addEdge(TaskId before, TaskId after) {
+	if (_running) {
+		throw std::logic_error("Cannot modify a running TaskGraph");
+	}
+	Node &from = _node(before);
+	Node &to = _node(after);
+	if (&from == &to) {
+		throw std::invalid_argument("A task cannot depend on itself");
+	}
+	from.successors.push_back(&to);
+	to.predecessors++;
+	_validated = false;
+}
+
+// Collects the roots and rejects cycles (Kahn's algorithm), once per change
+void TaskGraph::_validate() {
+	if (_validated) {
+		return;
+	}
+
+	_roots.clear();
+	std::vector<size_t> indegree(_nodes.size());
+	std::vector<Node*> ready;
+	for (Node &node : _nodes) {
+		if (node.predecessors == 0) {
+			_roots.push_back(&node);
+			ready.push_back(&node);
+		}
+	}
+	for (size_t i = 0; i < _nodes.size(); ++i) {
+		indegree[i] = _nodes[i].predecessors;
+	}
+
+	size_t visited = 0;
+	while (!ready.empty()) {
+		Node *node = ready.back();
+		ready.pop_back();
+		visited++;
+		for (Node *successor : node->successors) {
+			if (--indegree[successor->index] == 0) {
+				ready.push_back(successor);
+			}
+		}
+	}
+	if (visited != _nodes.size()) {
+		throw std::logic_error("TaskGraph has a cycle");
+	}
+	_validated = true;
+}
+
+TaskGraph::NodeJob::~NodeJob() {
+	if (_node) {
+		_graph->_execute(_node, true);
+	}
+}
+
+void TaskGraph::NodeJob::operator()() {
+	Node *node = _node;
+	_node = nullptr;
+	_graph->_execute(node);
+}
+
+// A job the pool refuses (shut down, or queuing threw) is destroyed unqueued,
+// which already fails the node, so the exception is not passed on
+void TaskGraph::_schedule(Node *node) {
+	try {
+		_pool->addJob(NodeJob(this, node));
+	} catch (...) {
+	}
+}
+
+void TaskGraph::_fail(std::exception_ptr error) {
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (!_error) {
+		_error = error;
+	}
+}
+
+void TaskGraph::_execute(Node *node, bool dropped) {
+	bool failed = dropped || node->skipped.load();
+	if (dropped) {
+		_fail(std::make_exception_ptr(std::runtime_error("TaskGraph task dropped before it ran")));
+	} else if (!failed) {
+		try {
+			if (node->work) {
+				node->work();
+			}
+		} catch (...) {
+			_fail(std::current_exception());
+			failed = true;
+		}
+	}
+
+	for (Node *successor : node->successors) {
+		if (failed) {
+			successor->skipped = true;
+		}
+		if (successor->pending.fetch_sub(1) == 1) {
+			_schedule(successor);
+		}
+	}
+
+	if (_remaining.fetch_sub(1) == 1) {
+		// Notify under the lock: run() may return, and the graph be destroyed, right after
+		std::lock_guard<std::mutex> lock(_mutex);
+		_finished = true;
+		_done.notify_all();
+	}
+}
+
+void TaskGraph::run(WorkerPool &pool) {
+	if (pool.isShutdown()) {
+		throw std::runtime_error("Cannot run a TaskGraph on a shut down WorkerPool");
+	}
+	if (_running.exchange(true)) {
+		throw std::logic_error("TaskGraph is already running");
+	}
+	try {
+		_validate();
+	} catch (...) {
+		_running = false;
+		throw;
+	}
+	if (_nodes.empty()) {
+		_running = false;
+		return;
+	}
+
+	for (Node &node : _nodes) {
+		node.pending.store(node.predecessors, std::memory_order_relaxed);
+		node.skipped.store(false, std::memory_order_relaxed);
+	}
+	_pool = &pool;
+	_error = nullptr;
+	_finished = false;
+	_remaining.store(_nodes.size());
+
+	for (Node *root : _roots) {
+		_schedule(root);
+	}
+
+	// From a job of the same pool the roots sit on this worker's own deque,
+	// so it runs queued jobs while it waits instead of only blocking
+	bool help = pool.isWorkerThread();
+	std::exception_ptr error;
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+		while (!_finished) {
+			if (!help) {
+				_done.wait(lock);
+				continue;
+			}
+			lock.unlock();
+			bool ran = pool.runPendingJob();
+			lock.lock();
+			if (!ran && !_finished) {
+				_done.wait_for(lock, std::chrono::microseconds(200));
+			}
+		}
+		error = _error;
+	}
+	_running = false;
+
+	if (error) {
+		std::rethrow_exception(error);
+	}
+}
+
+size_t TaskGraph::getTaskCount() const {
+	return _nodes.size();
+}
+
+const std::string &TaskGraph::getTaskName(TaskId id) const {
+	if (id >= _nodes.size()) {
+		throw std::out_of_range("Unknown TaskGraph task");
+	}
+	return _nodes[id].name;
+}
\ No newline at end of file
@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   task_graph.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hmunoz-g <hmunoz-g@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:12:20 by hmunoz-g          #+#    #+#             */
+/*   Updated: 2026/10/18 23:12:20 by hmunoz-g         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef TASK_GRAPH_HPP
+# define TASK_GRAPH_HPP
+
+# include <atomic>
+# include <condition_variable>
+# include <cstddef>
+# include <deque>
+# include <exception>
+# include <functional>
+# include <mutex>
+# include <string>
+# include <vector>
+
+# include "worker_pool.hpp"
+
+/*
+Dependency graph of tasks executed on a WorkerPool
+
+run() blocks until every task is done and rethrows the first exception; from a
+job of the same pool it runs queued jobs while it waits. One graph cannot run
+twice at the same time.
+*/
+class TaskGraph {
+	public:
+		using TaskId = size_t;
+
+	private:
+		struct Node {
+			std::function<void()> work;
+			std::string name;
+			size_t index = 0;
+			std::vector<Node*> successors;
+			size_t predecessors = 0;
+			std::atomic<size_t> pending{0};
+			// Set when a predecessor failed, the task is then skipped
+			std::atomic<bool> skipped{false};
+		};
+
+		// Deque: nodes hold atomics and are referenced by pointer, so they never move
+		std::deque<Node> _nodes;
+		std::vector<Node*> _roots;
+		bool _validated;
+
+		WorkerPool *_pool;
+		std::atomic<bool> _running;
+		std::atomic<size_t> _remaining;
+		std::exception_ptr _error;
+		bool _finished;
+		std::mutex _mutex;
+		std::condition_variable _done;
+
+		// Job queued for a node; destroyed without running, it fails the node
+		class NodeJob {
+			private:
+				TaskGraph *_graph;
+				Node *_node;
+
+			public:
+				NodeJob(TaskGraph *graph, Node *node): _graph(graph), _node(node) {}
+				NodeJob(NodeJob &&other) noexcept: _graph(other._graph), _node(other._node) { other._node = nullptr; }
+				NodeJob(const NodeJob &) = delete;
+				NodeJob &operator=(const NodeJob &) = delete;
+				NodeJob &operator=(NodeJob &&) = delete;
+				~NodeJob();
+
+				void operator()();
+		};
+
+		Node &_node(TaskId id);
+		void _validate();
+		void _schedule(Node *node);
+		void _execute(Node *node, bool dropped = false);
+		void _fail(std::exception_ptr error);
+
+	public:
+		TaskGraph();
+		~TaskGraph() = default;
+
+		TaskGraph(const TaskGraph &) = delete;
+		TaskGraph &operator=(const TaskGraph &) = delete;
+
+		TaskId addTask(std::function<void()> work, const std::string &name = "");
+		// `after` only starts once `before` has finished
+		void addEdge(TaskId before, TaskId after);
+
+		void run(WorkerPool &pool);
+
+		size_t getTaskCount() const;
+		const std::string &getTaskName(TaskId id) const;
+};
+
+#endif
\ No newline at end of file
@@ -13,48 +13,178 @@
 #ifndef THREAD_SAFE_QUEUE_HPP
 # define THREAD_SAFE_QUEUE_HPP
 
+# include <chrono>
+# include <algorithm>
+# include <condition_variable>
 # include <deque>
+# include <iterator>
+# include <limits>
+# include <memory_resource>
 # include <mutex>
+# include <optional>
 # include <stdexcept>
 
+/*
+Mutex-protected deque usable from any number of producers and consumers
+
+After close(), pushes return false and pops of an empty queue return at once.
+*/
 template<typename TType>
 class ThreadSafeQueue {
 	private:
-		std::deque<TType> _queue;
+		std::pmr::deque<TType> _queue;
 		mutable std::mutex _mutex;
+		std::condition_variable _notEmpty;
+		bool _closed = false;
+
+		// Caller holds the lock and has checked the queue is not empty
+		TType _takeFront() {
+			TType value = std::move(_queue.front());
+			_queue.pop_front();
+			return (value);
+		}
+
+		// Caller holds the lock
+		void _throwIfEmpty() const {
+			if (_queue.empty()) {
+				throw std::runtime_error(_closed ? "Queue is closed" : "Queue is empty");
+			}
+		}
+
+		// Runs `insert` under the lock unless the queue is closed
+		template<typename TInsert>
+		bool _push(TInsert insert) {
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				if (_closed) {
+					return (false);
+				}
+				insert();
+			}
+			_notEmpty.notify_one();
+			return (true);
+		}
 
 	public:
+		ThreadSafeQueue() = default;
+		explicit ThreadSafeQueue(std::pmr::memory_resource *resource): _queue(resource) {}
+
 		// Required
-		void push_back(const TType &element) {
-			std::lock_guard<std::mutex> lock(_mutex);
-			_queue.push_back(element);
+		// Pushes return false, leaving the element untouched, once the queue is closed
+		bool push_back(const TType &element) {
+			return (_push([&]() { _queue.push_back(element); }));
 		}
 
-		void push_front(const TType &element) {
-			std::lock_guard<std::mutex> lock(_mutex);
-			_queue.push_front(element);
+		bool push_front(const TType &element) {
+			return (_push([&]() { _queue.push_front(element); }));
+		}
+
+		// Move and in-place insertion, no copy of the element is ever made
+		bool push_back(TType &&element) {
+			return (_push([&]() { _queue.push_back(std::move(element)); }));
+		}
+
+		bool push_front(TType &&element) {
+			return (_push([&]() { _queue.push_front(std::move(element)); }));
+		}
+
+		template<typename... TArgs>
+		bool emplace_back(TArgs&&... args) {
+			return (_push([&]() { _queue.emplace_back(std::forward<TArgs>(args)...); }));
+		}
+
+		// Appends [first, last) under a single lock; wrap the iterators with
+		// std::make_move_iterator to move the elements in
+		template<typename InputIt>
+		bool push_range(InputIt first, InputIt last) {
+			size_t pushed = 0;
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				if (_closed) {
+					return (false);
+				}
+				for (; first != last; ++first, ++pushed) {
+					_queue.push_back(*first);
+				}
+			}
+			if (pushed == 1) {
+				_notEmpty.notify_one();
+			} else if (pushed > 1) {
+				_notEmpty.notify_all();
+			}
+			return (true);
 		}
 
 		TType pop_back() {
 			std::lock_guard<std::mutex> lock(_mutex);
-			if (_queue.empty()) {
-				throw std::runtime_error("Queue is empty");
-			}
+			_throwIfEmpty();
 
-			TType value = _queue.back();
+			TType value = std::move(_queue.back());
 			_queue.pop_back();
 			return (value);
 		}
 
 		TType pop_front() {
 			std::lock_guard<std::mutex> lock(_mutex);
+			_throwIfEmpty();
+
+			return (_takeFront());
+		}
+
+		// Moves up to `max` elements from the front into `out` under a single
+		// lock, returns how many were taken (never blocks)
+		template<typename OutputIt>
+		size_t drain(OutputIt out, size_t max = std::numeric_limits<size_t>::max()) {
+			std::lock_guard<std::mutex> lock(_mutex);
+			size_t count = _queue.size() < max ? _queue.size() : max;
+			auto end = _queue.begin() + count;
+			std::move(_queue.begin(), end, out);
+			_queue.erase(_queue.begin(), end);
+			return (count);
+		}
+
+		// Blocking and non-throwing pops, all taking from the front
+		// Empty optional only once the queue is closed and drained
+		std::optional<TType> wait_pop() {
+			std::unique_lock<std::mutex> lock(_mutex);
+			_notEmpty.wait(lock, [this]() { return !_queue.empty() || _closed; });
 			if (_queue.empty()) {
-				throw std::runtime_error("Queue is empty");
+				return (std::nullopt);
 			}
+			return (_takeFront());
+		}
 
-			TType value = _queue.front();
-			_queue.pop_front();
-			return (value);
+		// Empty optional if nothing arrived within `timeout` or the queue is closed and drained
+		template<typename Rep, typename Period>
+		std::optional<TType> wait_pop_for(const std::chrono::duration<Rep, Period> &timeout) {
+			std::unique_lock<std::mutex> lock(_mutex);
+			if (!_notEmpty.wait_for(lock, timeout, [this]() { return !_queue.empty() || _closed; })
+				|| _queue.empty()) {
+				return (std::nullopt);
+			}
+			return (_takeFront());
+		}
+
+		std::optional<TType> try_pop() {
+			std::lock_guard<std::mutex> lock(_mutex);
+			if (_queue.empty()) {
+				return (std::nullopt);
+			}
+			return (_takeFront());
+		}
+
+		// Rejects further pushes and wakes every blocked consumer
+		void close() {
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				_closed = true;
+			}
+			_notEmpty.notify_all();
+		}
+
+		bool isClosed() const {
+			std::lock_guard<std::mutex> lock(_mutex);
+			return (_closed);
 		}
 
 		// Utility
@@ -14,6 +14,16 @@
 #include <vector>
 #include <thread>
 #include <cstdlib>
+#include <chrono>
+#include <optional>
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <mutex>
+#include <algorithm>
+#include <cmath>
+#include <functional>
 
 #include "threading.hpp"
 #include "../IOStream/thread_safe_iostream.hpp"
@@ -109,6 +119,235 @@ void testThreadSafeQueueException() {
 	}
 }
 
+void testBlockingQueuePops() {
+	std::cout << YEL << "\n=== Testing thread safe queue blocking pops ===" << RESET << std::endl;
+
+	ThreadSafeQueue<int> safe_queue;
+
+	std::optional<int> nothing = safe_queue.try_pop();
+	std::cout << "try_pop on an empty queue returns a value: " << (nothing ? "true" : "false") << std::endl;
+
+	auto start = std::chrono::steady_clock::now();
+	std::optional<int> timedOut = safe_queue.wait_pop_for(std::chrono::milliseconds(50));
+	auto waited = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+	std::cout << "wait_pop_for gave up after ~" << (waited >= 50 ? 50 : waited) << " ms, value: " << (timedOut ? "true" : "false") << std::endl;
+
+	std::thread producer([&safe_queue](){
+		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+		safe_queue.push_back(42);
+	});
+	std::optional<int> value = safe_queue.wait_pop();
+	producer.join();
+	std::cout << GRN << "✓ wait_pop woke up with " << *value << RESET << std::endl;
+}
+
+void testClosableQueue() {
+	std::cout << YEL << "\n=== Testing thread safe queue close ===" << RESET << std::endl;
+
+	ThreadSafeQueue<int> safe_queue;
+	std::atomic<int> released(0);
+	std::vector<std::thread> consumers;
+	for (int i = 0; i < 3; ++i) {
+		consumers.emplace_back([&safe_queue, &released](){
+			while (safe_queue.wait_pop()) {}
+			released++;
+		});
+	}
+
+	safe_queue.push_back(1);
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	auto start = std::chrono::steady_clock::now();
+	safe_queue.close();
+	for (auto &consumer : consumers) {
+		consumer.join();
+	}
+	auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+	std::cout << "Blocked consumers released by close(): " << released << (elapsed < 50 ? " (immediately)" : " (slowly)") << std::endl;
+
+	std::cout << "push_back on a closed queue accepted: " << (safe_queue.push_back(2) ? "true" : "false") << std::endl;
+	try {
+		safe_queue.pop_front();
+	} catch (const std::runtime_error &e) {
+		std::cout << GRN << "✓ Correctly caught exception: " << e.what() << RESET << std::endl;
+	}
+
+	ThreadSafeQueue<int> draining;
+	draining.push_back(7);
+	draining.close();
+	std::optional<int> last = draining.wait_pop();
+	std::cout << "Elements queued before close() are still delivered: " << (last && *last == 7 ? "true" : "false")
+		<< ", then closed: " << (draining.wait_pop() ? "false" : "true") << std::endl;
+}
+
+void testQueueBatchOperations() {
+	std::cout << YEL << "\n=== Testing thread safe queue move and batch operations ===" << RESET << std::endl;
+
+	ThreadSafeQueue<std::unique_ptr<int>> owners;
+	owners.push_back(std::make_unique<int>(1));
+	owners.emplace_back(new int(2));
+	std::unique_ptr<int> first = owners.pop_front();
+	std::cout << "Move-only elements: popped " << *first << ", " << owners.size() << " left" << std::endl;
+
+	ThreadSafeQueue<std::string> lines;
+	std::vector<std::string> incoming = {"alpha", "beta", "gamma", "delta", "epsilon"};
+	lines.push_range(std::make_move_iterator(incoming.begin()), std::make_move_iterator(incoming.end()));
+
+	std::vector<std::string> batch;
+	size_t taken = lines.drain(std::back_inserter(batch), 3);
+	std::cout << "Drained " << taken << " lines (" << batch.front() << " .. " << batch.back() << "), "
+		<< lines.size() << " left" << std::endl;
+
+	taken = lines.drain(std::back_inserter(batch));
+	if (taken == 2 && batch.size() == 5 && batch.back() == "epsilon" && lines.empty()) {
+		std::cout << GRN << "✓ Range pushed and drained in order under one lock each" << RESET << std::endl;
+	} else {
+		std::cout << RED << "Batch operations lost or reordered elements" << RESET << std::endl;
+	}
+}
+
+// Moves `items` integers from `producers` threads to `consumers` threads, returns elapsed ms
+template<typename TQueue, typename TPush>
+long long runQueueBenchmark(TQueue &queue, TPush push, int producers, int consumers, int items, long long &sum) {
+	std::atomic<int> consumed(0);
+	std::atomic<long long> total(0);
+	std::vector<std::thread> threads;
+	int perProducer = items / producers;
+
+	auto start = std::chrono::steady_clock::now();
+	for (int p = 0; p < producers; ++p) {
+		threads.emplace_back([&queue, &push, perProducer](){
+			for (int i = 1; i <= perProducer; ++i) {
+				push(queue, i);
+			}
+		});
+	}
+	for (int c = 0; c < consumers; ++c) {
+		threads.emplace_back([&queue, &consumed, &total, perProducer, producers](){
+			long long local = 0;
+			while (consumed.load() < perProducer * producers) {
+				std::optional<int> value = queue.try_pop();
+				if (value) {
+					local += *value;
+					consumed++;
+				} else {
+					std::this_thread::yield();
+				}
+			}
+			total += local;
+		});
+	}
+	for (auto &thread : threads) {
+		thread.join();
+	}
+	sum = total;
+
+	return (std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+}
+
+void testQueueThroughput() {
+	std::cout << YEL << "\n=== Benchmarking ThreadSafeQueue against MPMCQueue ===" << RESET << std::endl;
+
+	const int PRODUCERS = 32;
+	const int CONSUMERS = 8;
+	const int ITEMS = 128000;
+	const long long expected = static_cast<long long>(PRODUCERS) * (ITEMS / PRODUCERS) * (ITEMS / PRODUCERS + 1) / 2;
+
+	ThreadSafeQueue<int> locked;
+	long long lockedSum = 0;
+	long long lockedMs = runQueueBenchmark(locked, [](ThreadSafeQueue<int> &queue, int value) {
+		queue.push_back(value);
+	}, PRODUCERS, CONSUMERS, ITEMS, lockedSum);
+
+	MPMCQueue<int> ring(1024);
+	long long ringSum = 0;
+	long long ringMs = runQueueBenchmark(ring, [](MPMCQueue<int> &queue, int value) {
+		queue.push_back(value);
+	}, PRODUCERS, CONSUMERS, ITEMS, ringSum);
+
+	std::cout << PRODUCERS << " producers, " << CONSUMERS << " consumers, " << ITEMS << " items" << std::endl;
+	std::cout << "ThreadSafeQueue: " << lockedMs << " ms, MPMCQueue (capacity " << ring.capacity() << "): " << ringMs << " ms" << std::endl;
+
+	MPMCQueue<int> bounded(3);
+	int accepted = 0;
+	while (bounded.try_push(accepted)) {
+		accepted++;
+	}
+	std::cout << "try_push refused at capacity " << bounded.capacity() << " after " << accepted << " pushes" << std::endl;
+
+	// A copy that throws leaves no claimed, unpublished slot behind
+	struct Fragile {
+		int value;
+		Fragile(int v): value(v) {}
+		Fragile(const Fragile &other): value(other.value) {
+			if (value < 0) {
+				throw std::runtime_error("copy failed");
+			}
+		}
+		Fragile(Fragile &&other) noexcept: value(other.value) {}
+	};
+	MPMCQueue<Fragile> fragile(4);
+	SPSCQueue<Fragile> fragilePipe(4);
+	Fragile broken(-1);
+	Fragile items[] = {Fragile(1), Fragile(-1), Fragile(3)};
+	try {
+		fragile.try_push(broken);
+	} catch (const std::runtime_error &) {}
+	fragile.try_push(Fragile(2));
+	try {
+		fragilePipe.write(items, 3);
+	} catch (const std::runtime_error &) {}
+	std::optional<Fragile> afterThrow = fragile.try_pop();
+	std::optional<Fragile> firstWritten = fragilePipe.try_pop();
+	std::cout << "After throwing copies: MPMC pops " << (afterThrow ? afterThrow->value : 0)
+		<< ", SPSC kept the copy made before the throw: " << (firstWritten && firstWritten->value == 1 && fragilePipe.empty() ? "true" : "false") << std::endl;
+
+	if (lockedSum == expected && ringSum == expected) {
+		std::cout << GRN << "✓ Every item delivered exactly once by both queues" << RESET << std::endl;
+	} else {
+		std::cout << RED << "Lost or duplicated items" << RESET << std::endl;
+	}
+}
+
+void testSPSCQueue() {
+	std::cout << YEL << "\n=== Testing wait-free SPSC queue ===" << RESET << std::endl;
+
+	const int ITEMS = 50000;
+	SPSCQueue<int> pipeline(256);
+
+	std::thread producer([&pipeline](){
+		int batch[32];
+		int next = 0;
+		while (next < ITEMS) {
+			int count = 0;
+			while (count < 32 && next + count < ITEMS) {
+				batch[count] = next + count;
+				count++;
+			}
+			next += static_cast<int>(pipeline.write(batch, count));
+		}
+	});
+
+	int expected = 0;
+	bool ordered = true;
+	int received[64];
+	while (expected < ITEMS) {
+		size_t count = pipeline.read(received, 64);
+		for (size_t i = 0; i < count; ++i) {
+			ordered = ordered && received[i] == expected;
+			expected++;
+		}
+	}
+	producer.join();
+
+	pipeline.push_back(7);
+	std::cout << "Single push/pop after batches: " << pipeline.pop_front() << ", empty: " << (pipeline.empty() ? "true" : "false") << std::endl;
+	if (ordered) {
+		std::cout << GRN << "✓ " << ITEMS << " items crossed the ring in batches, in order" << RESET << std::endl;
+	} else {
+		std::cout << RED << "SPSC queue reordered items" << RESET << std::endl;
+	}
+}
+
 void testThreadWrapper() {
 	std::cout << YEL << "\n=== Testing thread wrapper ===" << RESET << std::endl;
 
@@ -158,6 +397,460 @@ void testWorkerPool() {
 	std::cout << GRN << "Worker pool test completed!" << RESET << std::endl;
 }
 
+void testPriorityWorkerPool() {
+	std::cout << YEL << "\n=== Testing worker pool with priority lanes ===" << RESET << std::endl;
+
+	ConcurrentPriorityQueue<std::string> lanes(3);
+	lanes.push("bulk-1", 2);
+	lanes.push("reply-1", 0);
+	lanes.push("bulk-2", 2);
+	lanes.push("reply-2", 0);
+	lanes.push("log-1", 1);
+	std::string order;
+	while (std::optional<std::string> next = lanes.try_pop()) {
+		order += *next + " ";
+	}
+	std::cout << "Pop order: " << order << std::endl;
+
+	// Lanes are rings: wrap around, then grow while wrapped, keeping FIFO order
+	ConcurrentPriorityQueue<int> ring(1, 4);
+	int nextIn = 0;
+	int nextOut = 0;
+	bool fifo = true;
+	for (int i = 0; i < 3; ++i) {
+		ring.push(nextIn++, 0);
+	}
+	for (int i = 0; i < 2; ++i) {
+		fifo = fifo && ring.pop_front() == nextOut++;
+	}
+	for (int i = 0; i < 10; ++i) {
+		ring.push(nextIn++, 0);
+	}
+	while (std::optional<int> value = ring.try_pop()) {
+		fifo = fifo && *value == nextOut++;
+	}
+	std::cout << "Ring lane kept FIFO order across wrap and growth: " << (fifo && nextOut == nextIn ? "true" : "false") << std::endl;
+
+	std::mutex orderMutex;
+	std::vector<std::string> ran;
+	std::atomic<bool> release(false);
+	{
+		WorkerPool pool(1, 2);
+		pool.addJob([&release](){
+			while (!release) {
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+		});
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		for (int i = 0; i < 3; ++i) {
+			pool.addJob([i, &ran, &orderMutex](){
+				std::lock_guard<std::mutex> lock(orderMutex);
+				ran.push_back("bulk-" + std::to_string(i));
+			});
+		}
+		for (int i = 0; i < 2; ++i) {
+			pool.addJob([i, &ran, &orderMutex](){
+				std::lock_guard<std::mutex> lock(orderMutex);
+				ran.push_back("heartbeat-" + std::to_string(i));
+			}, 0);
+		}
+		release = true;
+		while (pool.getQueueSize() > 0) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(5));
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	}
+
+	std::lock_guard<std::mutex> lock(orderMutex);
+	if (ran.size() == 5 && ran[0] == "heartbeat-0" && ran[1] == "heartbeat-1" && ran[2] == "bulk-0" && ran[4] == "bulk-2") {
+		std::cout << GRN << "✓ Heartbeats overtook queued bulk jobs, FIFO within each priority" << RESET << std::endl;
+	} else {
+		std::cout << RED << "Priority order not respected" << RESET << std::endl;
+	}
+
+	// A heartbeat from outside overtakes jobs a worker fanned out to its own deque
+	std::mutex fanOutMutex;
+	std::vector<std::string> fanOut;
+	std::atomic<bool> queued(false);
+	std::atomic<bool> heartbeatAdded(false);
+	{
+		WorkerPool pool(1, 2);
+		pool.addJob([&](){
+			for (int i = 0; i < 5; ++i) {
+				pool.addJob([i, &fanOut, &fanOutMutex](){
+					std::lock_guard<std::mutex> lock(fanOutMutex);
+					fanOut.push_back("bulk" + std::to_string(i));
+				});
+			}
+			queued = true;
+			while (!heartbeatAdded) {
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+		});
+		while (!queued) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+		pool.addJob([&fanOut, &fanOutMutex](){
+			std::lock_guard<std::mutex> lock(fanOutMutex);
+			fanOut.push_back("HEARTBEAT");
+		}, 0);
+		heartbeatAdded = true;
+		while (true) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(5));
+			std::lock_guard<std::mutex> lock(fanOutMutex);
+			if (fanOut.size() == 6) {
+				break;
+			}
+		}
+	}
+	std::string fanOutOrder;
+	for (const std::string &name : fanOut) {
+		fanOutOrder += name + " ";
+	}
+	std::cout << "Order after local fan-out: " << fanOutOrder << std::endl;
+}
+
+void testWorkStealingPool() {
+	std::cout << YEL << "\n=== Testing worker pool work stealing ===" << RESET << std::endl;
+
+	const int DEPTH = 8;
+	std::atomic<int> leaves(0);
+	std::mutex idsMutex;
+	std::vector<std::thread::id> ids;
+
+	WorkerPool pool(4);
+	// Each job splits in two until DEPTH, children land on the spawning worker's deque
+	std::function<void(int)> split = [&](int depth) {
+		if (depth == DEPTH) {
+			std::this_thread::sleep_for(std::chrono::microseconds(200));
+			std::lock_guard<std::mutex> lock(idsMutex);
+			if (std::find(ids.begin(), ids.end(), std::this_thread::get_id()) == ids.end()) {
+				ids.push_back(std::this_thread::get_id());
+			}
+			leaves++;
+			return;
+		}
+		pool.addJob([&split, depth]() { split(depth + 1); });
+		pool.addJob([&split, depth]() { split(depth + 1); });
+	};
+	pool.addJob([&split]() { split(0); });
+
+	auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(20);
+	while (leaves < (1 << DEPTH) && std::chrono::steady_clock::now() < deadline) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+
+	std::cout << "Recursive fan-out finished " << leaves << " of " << (1 << DEPTH) << " leaf jobs" << std::endl;
+	if (leaves == (1 << DEPTH) && ids.size() > 1) {
+		std::cout << GRN << "✓ Work spawned on one worker was stolen by the others" << RESET << std::endl;
+	} else {
+		std::cout << RED << "Recursive jobs were not spread across workers" << RESET << std::endl;
+	}
+}
+
+void testMoveOnlyJobs() {
+	std::cout << YEL << "\n=== Testing move-only jobs ===" << RESET << std::endl;
+
+	struct Capture { long long values[7]; };
+	struct Oversized { char bytes[Job::inlineSize + 1]; };
+	Capture capture = {};
+	Oversized oversized = {};
+	auto small = [capture]() { (void)capture; };
+	auto large = [oversized]() { (void)oversized; };
+	std::cout << "sizeof(Job): " << sizeof(Job) << " bytes" << std::endl;
+	std::cout << "56-byte capture stored inline: " << (Job::fitsInline<decltype(small)> ? "true" : "false") << std::endl;
+	std::cout << "oversized capture stored inline: " << (Job::fitsInline<decltype(large)> ? "true" : "false") << std::endl;
+	std::cout << "empty std::function gives an empty Job: " << (!Job(std::function<void()>()) ? "true" : "false") << std::endl;
+
+	class CountingJob : public IJobs {
+		private:
+			std::atomic<int> &_counter;
+		public:
+			explicit CountingJob(std::atomic<int> &counter): _counter(counter) {}
+			void execute() override { _counter++; }
+	};
+
+	std::atomic<int> ran(0);
+	{
+		WorkerPool pool(4);
+		for (int i = 0; i < 100; ++i) {
+			auto owned = std::make_unique<int>(i);
+			pool.addJob([owned = std::move(owned), &ran]() { ran += *owned >= 0 ? 1 : 0; });
+		}
+		for (int i = 0; i < 100; ++i) {
+			pool.addJob(std::make_unique<CountingJob>(ran));
+		}
+		pool.addJob([large, &ran]() { (void)large; ran++; });
+		while (ran < 201) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+	}
+	std::cout << "unique_ptr captures, IJobs and heap-stored jobs ran: " << ran << " (expected 201)" << std::endl;
+}
+
+void testWorkerPoolFutures() {
+	std::cout << YEL << "\n=== Testing worker pool futures ===" << RESET << std::endl;
+
+	WorkerPool pool(4);
+
+	JobFuture<int> answer = pool.submit([](int a, int b) { return a * b; }, 6, 7);
+	JobFuture<std::string> described = answer.then([](const int &value) {
+		return "answer is " + std::to_string(value);
+	});
+	std::cout << "submit + then: " << described.get() << std::endl;
+
+	std::vector<JobFuture<long long>> parts;
+	for (int chunk = 0; chunk < 8; ++chunk) {
+		parts.push_back(pool.submit([chunk]() {
+			long long sum = 0;
+			for (int i = chunk * 1000; i < (chunk + 1) * 1000; ++i) {
+				sum += i;
+			}
+			return sum;
+		}));
+	}
+	JobFuture<std::vector<long long>> joined = when_all(parts);
+	long long total = 0;
+	for (long long part : joined.get()) {
+		total += part;
+	}
+	std::cout << "when_all over 8 chunks: " << total << " (expected " << 7999LL * 8000 / 2 << ")" << std::endl;
+
+	std::atomic<int> sideEffect(0);
+	JobFuture<void> done = pool.submit([&sideEffect]() { sideEffect = 1; });
+	done.then([&sideEffect]() { sideEffect++; }).wait();
+	std::cout << "void job and continuation both ran: " << (sideEffect == 2 ? "true" : "false") << std::endl;
+
+	JobFuture<int> failing = pool.submit([]() -> int { throw std::runtime_error("division by zero"); });
+	try {
+		failing.then([](const int &value) { return value + 1; }).get();
+	} catch (const std::runtime_error &e) {
+		std::cout << GRN << "✓ Correctly caught exception through then(): " << e.what() << RESET << std::endl;
+	}
+}
+
+void testWorkerPoolStats() {
+	std::cout << YEL << "\n=== Testing worker pool stats ===" << RESET << std::endl;
+
+	WorkerPool pool(4);
+	std::cout << "stats off by default: " << (!pool.isStatsEnabled() ? "true" : "false") << std::endl;
+	pool.enableStats();
+
+	std::atomic<int> done(0);
+	for (int i = 0; i < 200; ++i) {
+		pool.addJob([i, &done]() {
+			if (i % 50 == 0) {
+				done++;
+				throw std::runtime_error("expected failure");
+			}
+			std::this_thread::sleep_for(std::chrono::microseconds(100));
+			done++;
+		});
+	}
+	while (done < 200) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	// Lets the workers fall asleep, then wakes one so it accounts for that idle time
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	pool.addJob([&done]() { done++; });
+	while (done < 201) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+	WorkerPoolStats stats = pool.getStats();
+	WorkerStatsSnapshot total = stats.total();
+	uint64_t waited = 0;
+	uint64_t timed = 0;
+	uint64_t longJobs = 0;
+	for (size_t i = 0; i < WorkerStatsSnapshot::histogramBuckets; ++i) {
+		waited += total.queueWait[i];
+		timed += total.executionTime[i];
+		// 100us sleeps land at or above the 2^16 ns bucket
+		if (i >= 16) {
+			longJobs += total.executionTime[i];
+		}
+	}
+	std::cout << "per-worker entries: " << stats.workers.size() << std::endl;
+	std::cout << "jobs executed: " << total.jobsExecuted << " (expected 201), failed: " << total.jobsFailed << " (expected 4)" << std::endl;
+	std::cout << "every job has a queue wait and an execution time: " << (waited == 201 && timed == 201 ? "true" : "false") << std::endl;
+	std::cout << "sleeping jobs in the upper histogram buckets: " << (longJobs >= 196 ? "true" : "false") << std::endl;
+	std::cout << "workers recorded idle time: " << (total.idleNanoseconds > 0 ? "true" : "false") << std::endl;
+
+	pool.resetStats();
+	pool.enableStats(false);
+	done = 0;
+	pool.addJob([&done]() { done++; });
+	while (done < 1) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	std::cout << "nothing counted while off: " << (pool.getStats().total().jobsExecuted == 0 ? "true" : "false") << std::endl;
+}
+
+void testParallelAlgorithms() {
+	std::cout << YEL << "\n=== Testing parallel algorithms on the worker pool ===" << RESET << std::endl;
+
+	WorkerPool pool(4);
+	const size_t COUNT = 100000;
+
+	std::vector<double> noise(COUNT);
+	parallel_for(pool, 0, COUNT, [&noise](size_t i) {
+		noise[i] = static_cast<double>((i * 2654435761u) % 1000) / 1000.0;
+	});
+
+	double sum = parallel_reduce(pool, 0, COUNT, 0.0,
+		[&noise](size_t i) { return noise[i]; },
+		[](double a, double b) { return a + b; });
+	double serial = 0.0;
+	for (double value : noise) {
+		serial += value;
+	}
+	std::cout << "parallel_reduce sum matches serial sum: " << (std::abs(sum - serial) < 1e-6 ? "true" : "false") << std::endl;
+
+	std::vector<int> scaled(COUNT);
+	parallel_transform(pool, noise.begin(), noise.end(), scaled.begin(), [](double value) {
+		return static_cast<int>(value * 100);
+	});
+
+	std::vector<std::pair<int, size_t>> records(COUNT);
+	parallel_for(pool, 0, COUNT, [&](size_t i) { records[i] = {scaled[i], i}; });
+	parallel_sort(pool, records.begin(), records.end(), [](const std::pair<int, size_t> &a, const std::pair<int, size_t> &b) {
+		return a.first < b.first;
+	});
+	bool sorted = true;
+	for (size_t i = 1; i < COUNT; ++i) {
+		const auto &previous = records[i - 1];
+		const auto &current = records[i];
+		sorted = sorted && (previous.first < current.first || (previous.first == current.first && previous.second < current.second));
+	}
+	std::cout << "parallel_sort produced a stable ascending order: " << (sorted ? "true" : "false") << std::endl;
+
+	std::atomic<int> nestedTotal(0);
+	pool.submit([&pool, &nestedTotal]() {
+		parallel_for(pool, 0, 1000, [&nestedTotal](size_t) { nestedTotal++; });
+	}).get();
+	std::cout << "parallel_for called from inside a job completed: " << nestedTotal << " iterations" << std::endl;
+
+	try {
+		parallel_for(pool, 0, 100, [](size_t i) {
+			if (i == 42) {
+				throw std::runtime_error("bad sample 42");
+			}
+		});
+	} catch (const std::runtime_error &e) {
+		std::cout << GRN << "✓ Correctly caught exception: " << e.what() << RESET << std::endl;
+	}
+}
+
+void testTaskGraph() {
+	std::cout << YEL << "\n=== Testing task graph scheduling ===" << RESET << std::endl;
+
+	WorkerPool pool(4);
+	TaskGraph frame;
+	std::mutex logMutex;
+	std::vector<std::string> log;
+	auto step = [&log, &logMutex](const std::string &name) {
+		return [&log, &logMutex, name]() {
+			std::this_thread::sleep_for(std::chrono::milliseconds(5));
+			std::lock_guard<std::mutex> lock(logMutex);
+			log.push_back(name);
+		};
+	};
+
+	// decode -> (physics, audio) -> serialize -> send
+	TaskGraph::TaskId decode = frame.addTask(step("decode"), "decode");
+	TaskGraph::TaskId physics = frame.addTask(step("physics"), "physics");
+	TaskGraph::TaskId audio = frame.addTask(step("audio"), "audio");
+	TaskGraph::TaskId serialize = frame.addTask(step("serialize"), "serialize");
+	TaskGraph::TaskId send = frame.addTask(step("send"), "send");
+	frame.addEdge(decode, physics);
+	frame.addEdge(decode, audio);
+	frame.addEdge(physics, serialize);
+	frame.addEdge(audio, serialize);
+	frame.addEdge(serialize, send);
+
+	bool ordered = true;
+	for (int run = 0; run < 3; ++run) {
+		log.clear();
+		frame.run(pool);
+		auto position = [&log](const std::string &name) {
+			return std::find(log.begin(), log.end(), name) - log.begin();
+		};
+		ordered = ordered && log.size() == 5 && position("decode") == 0
+			&& position("serialize") == 3 && position("send") == 4;
+	}
+	std::cout << "Graph of " << frame.getTaskCount() << " tasks ran 3 times respecting every edge: "
+		<< (ordered ? "true" : "false") << std::endl;
+
+	TaskGraph broken;
+	TaskGraph::TaskId first = broken.addTask([]() {}, "first");
+	TaskGraph::TaskId second = broken.addTask([]() { throw std::runtime_error("simulation diverged"); }, "second");
+	bool skipped = true;
+	TaskGraph::TaskId third = broken.addTask([&skipped]() { skipped = false; }, "third");
+	broken.addEdge(first, second);
+	broken.addEdge(second, third);
+	try {
+		broken.run(pool);
+	} catch (const std::runtime_error &e) {
+		std::cout << "Failure propagated: " << e.what() << ", dependent task skipped: " << (skipped ? "true" : "false") << std::endl;
+	}
+
+	broken.addEdge(third, first);
+	try {
+		broken.run(pool);
+	} catch (const std::logic_error &e) {
+		std::cout << GRN << "✓ Correctly caught exception: " << e.what() << RESET << std::endl;
+	}
+
+	// Run from the only worker of a pool: that worker runs the graph's tasks itself
+	WorkerPool single(1);
+	std::atomic<int> nestedTasks(0);
+	TaskGraph nested;
+	TaskGraph::TaskId produce = nested.addTask([&nestedTasks]() { nestedTasks++; }, "produce");
+	TaskGraph::TaskId consume = nested.addTask([&nestedTasks]() { nestedTasks++; }, "consume");
+	nested.addEdge(produce, consume);
+	single.submit([&nested, &single]() { nested.run(single); }).get();
+	std::cout << "Graph run from a job of a one-worker pool finished " << nestedTasks.load() << " tasks" << std::endl;
+
+	// The pool shuts down while the graph runs: the tasks it drops fail the run
+	WorkerPool stopping(1);
+	std::atomic<bool> rootStarted(false);
+	std::atomic<bool> releaseRoot(false);
+	bool leafRan = false;
+	TaskGraph interrupted;
+	TaskGraph::TaskId root = interrupted.addTask([&]() {
+		rootStarted = true;
+		while (!releaseRoot) {
+			std::this_thread::yield();
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	}, "root");
+	TaskGraph::TaskId leaf = interrupted.addTask([&leafRan]() { leafRan = true; }, "leaf");
+	interrupted.addEdge(root, leaf);
+
+	std::string outcome = "returned normally";
+	std::thread runner([&]() {
+		try {
+			interrupted.run(stopping);
+		} catch (const std::runtime_error &e) {
+			outcome = e.what();
+		}
+	});
+	while (!rootStarted) {
+		std::this_thread::yield();
+	}
+	releaseRoot = true;
+	stopping.shutdownPool();
+	runner.join();
+	std::cout << "Run interrupted by shutdown: " << outcome << ", leaf ran: " << (leafRan ? "true" : "false") << std::endl;
+
+	try {
+		interrupted.run(stopping);
+	} catch (const std::runtime_error &e) {
+		std::cout << GRN << "✓ Correctly caught exception: " << e.what() << RESET << std::endl;
+	}
+}
+
 void testPersistentWorker() {
 	std::cout << YEL << "\n=== Testing worker pool ===" << RESET << std::endl;
 
@@ -196,8 +889,20 @@ int main(void) {
 
 	testThreadSafeQueue();
 	testThreadSafeQueueException();
+	testBlockingQueuePops();
+	testQueueBatchOperations();
+	testClosableQueue();
+	testQueueThroughput();
+	testSPSCQueue();
 	testThreadWrapper();
 	testWorkerPool();
+	testPriorityWorkerPool();
+	testWorkStealingPool();
+	testMoveOnlyJobs();
+	testWorkerPoolFutures();
+	testWorkerPoolStats();
+	testParallelAlgorithms();
+	testTaskGraph();
 	testPersistentWorker();
 
 	std::cout << GRN << "\nAll tests completed successfully!" << std::endl;
@@ -14,8 +14,16 @@
 # define THREADING_HPP
 
 # include "thread_safe_queue.hpp"
+# include "mpmc_queue.hpp"
+# include "spsc_queue.hpp"
+# include "priority_queue.hpp"
+# include "work_stealing_deque.hpp"
+# include "job.hpp"
 # include "thread.hpp"
+# include "worker_pool_stats.hpp"
 # include "worker_pool.hpp"
 # include "persistent_worker.hpp"
+# include "parallel_algorithms.hpp"
+# include "task_graph.hpp"
 
 #endif
\ No newline at end of file
@@ -0,0 +1,133 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   work_stealing_deque.hpp                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hmunoz-g <hmunoz-g@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:47:15 by hmunoz-g          #+#    #+#             */
+/*   Updated: 2026/10/18 20:47:15 by hmunoz-g         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef WORK_STEALING_DEQUE_HPP
+# define WORK_STEALING_DEQUE_HPP
+
+# include <atomic>
+# include <cstddef>
+# include <cstdint>
+# include <memory>
+# include <optional>
+# include <type_traits>
+# include <vector>
+
+# include "../data_structures/pool_storage.hpp"
+
+/*
+Chase-Lev work-stealing deque
+
+The owner pushes and pops at the bottom, thieves steal from the top.
+TType must be trivially copyable.
+*/
+template<typename TType>
+class WorkStealingDeque {
+	static_assert(std::is_trivially_copyable<TType>::value, "WorkStealingDeque elements must be trivially copyable");
+
+	private:
+		struct Ring {
+			int64_t mask;
+			std::unique_ptr<std::atomic<TType>[]> slots;
+
+			explicit Ring(int64_t capacity): mask(capacity - 1), slots(new std::atomic<TType>[capacity]) {}
+
+			int64_t capacity() const { return (mask + 1); }
+			TType get(int64_t index) const { return (slots[index & mask].load(std::memory_order_relaxed)); }
+			void put(int64_t index, TType value) { slots[index & mask].store(value, std::memory_order_relaxed); }
+		};
+
+		alignas(cacheLineSize) std::atomic<int64_t> _top;
+		alignas(cacheLineSize) std::atomic<int64_t> _bottom;
+		std::atomic<Ring*> _ring;
+		// Every ring ever used, owned here and only touched by the owner thread
+		std::vector<std::unique_ptr<Ring>> _rings;
+
+		Ring *_grow(Ring *ring, int64_t top, int64_t bottom) {
+			auto bigger = std::make_unique<Ring>(ring->capacity() * 2);
+			for (int64_t i = top; i < bottom; ++i) {
+				bigger->put(i, ring->get(i));
+			}
+			_rings.push_back(std::move(bigger));
+			_ring.store(_rings.back().get(), std::memory_order_release);
+			return (_rings.back().get());
+		}
+
+	public:
+		explicit WorkStealingDeque(size_t capacity = 256): _top(0), _bottom(0) {
+			_rings.push_back(std::make_unique<Ring>(static_cast<int64_t>(roundUpPowerOfTwo(capacity))));
+			_ring.store(_rings.back().get(), std::memory_order_relaxed);
+		}
+
+		WorkStealingDeque(const WorkStealingDeque &) = delete;
+		WorkStealingDeque &operator=(const WorkStealingDeque &) = delete;
+
+		// Owner only
+		void push(TType value) {
+			int64_t bottom = _bottom.load(std::memory_order_relaxed);
+			int64_t top = _top.load(std::memory_order_acquire);
+			Ring *ring = _ring.load(std::memory_order_relaxed);
+			if (bottom - top >= ring->capacity()) {
+				ring = _grow(ring, top, bottom);
+			}
+			ring->put(bottom, value);
+			_bottom.store(bottom + 1, std::memory_order_release);
+		}
+
+		// Owner only, newest element first
+		std::optional<TType> pop() {
+			int64_t bottom = _bottom.load(std::memory_order_relaxed) - 1;
+			Ring *ring = _ring.load(std::memory_order_relaxed);
+			_bottom.store(bottom, std::memory_order_seq_cst);
+			int64_t top = _top.load(std::memory_order_seq_cst);
+
+			if (top > bottom) {
+				_bottom.store(bottom + 1, std::memory_order_relaxed);
+				return (std::nullopt);
+			}
+			TType value = ring->get(bottom);
+			if (top == bottom) {
+				// Last element: race the thieves for it
+				bool won = _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+				_bottom.store(bottom + 1, std::memory_order_relaxed);
+				if (!won) {
+					return (std::nullopt);
+				}
+			}
+			return (value);
+		}
+
+		// Any thread, oldest element first; empty optional if empty or another thread won the race
+		std::optional<TType> steal() {
+			int64_t top = _top.load(std::memory_order_seq_cst);
+			int64_t bottom = _bottom.load(std::memory_order_seq_cst);
+			if (top >= bottom) {
+				return (std::nullopt);
+			}
+			Ring *ring = _ring.load(std::memory_order_acquire);
+			TType value = ring->get(top);
+			if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+				return (std::nullopt);
+			}
+			return (value);
+		}
+
+		// Snapshot, exact only on the owner thread while nobody steals
+		size_t size() const {
+			int64_t bottom = _bottom.load(std::memory_order_acquire);
+			int64_t top = _top.load(std::memory_order_acquire);
+			return (bottom > top ? static_cast<size_t>(bottom - top) : 0);
+		}
+
+		bool empty() const { return (size() == 0); }
+};
+
+#endif
\ No newline at end of file
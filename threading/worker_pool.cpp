@@ -11,36 +11,161 @@
 /* ************************************************************************** */
 
 #include "worker_pool.hpp"
-#include "../colors.h"
 #include "../IOStream/thread_safe_iostream.hpp"
 
 extern ThreadSafeIOStream threadSafeCout;
 
+thread_local WorkerPool *WorkerPool::_currentPool = nullptr;
+thread_local size_t WorkerPool::_currentWorker = 0;
+
+bool WorkerPool::_takeInjected(QueuedJob &queued) {
+	if (std::optional<QueuedJob> injected = _jobQueue.try_pop()) {
+		queued = std::move(*injected);
+		_pendingJobs--;
+		return true;
+	}
+	return false;
+}
+
+// Prioritized jobs first: local jobs all sit at the lowest priority. Then the
+// own deque, the rest of the injection queue and a steal from a random victim.
+bool WorkerPool::_takeJob(size_t workerId, uint64_t &seed, QueuedJob &queued) {
+	if ((_jobQueue.nonEmptyLanes() & _urgentLanes) != 0 && _takeInjected(queued)) {
+		return true;
+	}
+
+	std::optional<QueuedJob*> local = _localQueues[workerId]->pop();
+	if (!local) {
+		if (_takeInjected(queued)) {
+			return true;
+		}
+
+		size_t count = _localQueues.size();
+		seed ^= seed << 13;
+		seed ^= seed >> 7;
+		seed ^= seed << 17;
+		size_t start = static_cast<size_t>(seed % count);
+		for (size_t i = 0; i < count && !local; ++i) {
+			size_t victim = (start + i) % count;
+			if (victim != workerId) {
+				local = _localQueues[victim]->steal();
+			}
+		}
+		if (!local) {
+			return false;
+		}
+	}
+
+	queued = std::move(**local);
+	_freeLocal(*local);
+	_pendingJobs--;
+	return true;
+}
+
+WorkerPool::QueuedJob *WorkerPool::_storeLocal(QueuedJob &&queued) {
+	if (std::optional<ConcurrentPool<QueuedJob>::Object> slot = _localJobs.tryAcquire(std::move(queued))) {
+		return slot->release();
+	}
+	return new QueuedJob(std::move(queued));
+}
+
+void WorkerPool::_freeLocal(QueuedJob *queued) {
+	if (_localJobs.owns(queued)) {
+		queued->~QueuedJob();
+		_localJobs.returnObject(queued);
+	} else {
+		delete queued;
+	}
+}
+
+void WorkerPool::_wakeOne() {
+	if (_sleepers.load() > 0) {
+		// Taking the lock orders this notify after a sleeper's predicate check
+		{
+			std::lock_guard<std::mutex> lock(_idleMutex);
+		}
+		_wakeup.notify_one();
+	}
+}
+
+// Idle workers sleep until a job is queued anywhere and wake as soon as one is
 void WorkerPool::_workerFunction(int workerId) {
+	_currentPool = this;
+	_currentWorker = workerId;
+	// Keeps the slots of the jobs this worker queues and runs close at hand
+	ConcurrentPool<QueuedJob>::ThreadCache slotCache(_localJobs);
+	WorkerCounters &counters = *_counters[workerId];
+	uint64_t seed = 0x9E3779B97F4A7C15ull * (static_cast<uint64_t>(workerId) + 1);
+	QueuedJob queued;
+
 	while(!_shutdown) {
-		try {
-			threadSafeCout << MAG << "Worker " << workerId << " assigned to job when queue has size " << _jobQueue.size() << "!" << RESET << std::endl;
-			auto job = _jobQueue.pop_front();
-
-			job();
-		} catch (const std::runtime_error &e) {
-			std::this_thread::sleep_for(std::chrono::milliseconds(10));
-		} catch (...) {
-			threadSafeCout << "Job execution failed" << std::endl;
+		bool measure = _statsEnabled.load(std::memory_order_relaxed);
+
+		if (!_takeJob(workerId, seed, queued)) {
+			Clock::time_point idleSince = measure ? Clock::now() : Clock::time_point();
+			{
+				std::unique_lock<std::mutex> lock(_idleMutex);
+				_sleepers++;
+				_wakeup.wait(lock, [this]() { return _shutdown || _pendingJobs.load() > 0; });
+				_sleepers--;
+			}
+			if (measure) {
+				counters.recordIdle(Clock::now() - idleSince);
+			}
+			continue;
+		}
+
+		_runJob(queued, counters);
+	}
+
+	_currentPool = nullptr;
+}
+
+void WorkerPool::_runJob(QueuedJob &queued, WorkerCounters &counters) {
+	bool measure = _statsEnabled.load(std::memory_order_relaxed);
+	Clock::time_point started;
+	if (measure) {
+		started = Clock::now();
+		// Jobs queued before stats were turned on carry no timestamp
+		if (queued.queuedAt != Clock::time_point()) {
+			counters.recordQueueWait(started - queued.queuedAt);
 		}
 	}
+
+	bool failed = false;
+	try {
+		queued.job();
+	} catch (...) {
+		failed = true;
+		threadSafeCout << "Job execution failed" << std::endl;
+	}
+	if (measure) {
+		counters.recordJob(Clock::now() - started, failed);
+	}
+	queued.job = nullptr;
 }
 
-WorkerPool::WorkerPool(size_t numWorkers): _shutdown(false) {
+WorkerPool::WorkerPool(size_t numWorkers, size_t priorityLevels)
+	: _jobQueue(priorityLevels, _injectedJobSlotsPerLane),
+	_urgentLanes((uint64_t(1) << (_jobQueue.levels() - 1)) - 1), _shutdown(false), _statsEnabled(false),
+	_pendingJobs(0), _sleepers(0) {
 	if (numWorkers == 0) {
 		numWorkers = std::thread::hardware_concurrency();
 	}
+	if (numWorkers == 0) {
+		numWorkers = 1;
+	}
 	
+	_localJobs.resize(numWorkers * _localJobSlotsPerWorker);
 	_workers.reserve(numWorkers);
+	_localQueues.reserve(numWorkers);
+	_counters.reserve(numWorkers);
 
 	for (size_t i = 0; i < numWorkers; ++i) {
 		std::string workerName = "Worker-" + std::to_string(i);
 
+		_localQueues.push_back(std::make_unique<WorkStealingDeque<QueuedJob*>>());
+		_counters.push_back(std::make_unique<WorkerCounters>());
 		_workers.emplace_back(workerName, [this, i](){
 			this->_workerFunction(i);
 		});
@@ -55,34 +180,120 @@ WorkerPool::~WorkerPool() {
 	shutdownPool(); 
 }
 
-void WorkerPool::addJob(const std::function<void()> & jobToExecute) {
-	if (!_shutdown) {
-		_jobQueue.push_back(jobToExecute);
+void WorkerPool::_enqueue(Job &&job, size_t priority) {
+	if (_shutdown) {
+		return;
 	}
-}
 
-void WorkerPool::addJob(std::unique_ptr<IJobs> job) {
-	if (!_shutdown) {
-		std::shared_ptr<IJobs> sharedJob = std::move(job);
-		
-		_jobQueue.push_back([sharedJob](){
-			sharedJob->execute();
-		});
+	QueuedJob queued = {std::move(job),
+		_statsEnabled.load(std::memory_order_relaxed) ? Clock::now() : Clock::time_point()};
+	if (priority == lowestPriority && _currentPool == this) {
+		_localQueues[_currentWorker]->push(_storeLocal(std::move(queued)));
+	} else {
+		if (priority == lowestPriority) {
+			priority = _jobQueue.levels() - 1;
+		}
+		if (!_jobQueue.push(std::move(queued), priority)) {
+			return;
+		}
 	}
+	_pendingJobs++;
+	_wakeOne();
+}
+
+void WorkerPool::addJob(Job jobToExecute, size_t priority) {
+	_enqueue(std::move(jobToExecute), priority);
+}
+
+void WorkerPool::addJob(std::unique_ptr<IJobs> job, size_t priority) {
+	_enqueue([job = std::move(job)](){
+		job->execute();
+	}, priority);
 }
 
 void WorkerPool::shutdownPool() {
-	_shutdown = true;
+	if (_shutdown.exchange(true)) {
+		return;
+	}
+
+	// Wakes every idle worker at once; jobs still queued are dropped
+	_jobQueue.close();
+	{
+		std::lock_guard<std::mutex> lock(_idleMutex);
+	}
+	_wakeup.notify_all();
 
 	for (auto &worker : _workers) {
 		worker.stop();
 	}
+
+	// Workers are joined, so every queue can be emptied from here. Dropped jobs
+	// are destroyed outside the queue locks, their destructors may queue more.
+	while (_jobQueue.try_pop()) {
+	}
+	for (auto &queue : _localQueues) {
+		while (std::optional<QueuedJob*> queued = queue->pop()) {
+			_freeLocal(*queued);
+		}
+	}
 }
 
 size_t WorkerPool::getQueueSize() const { 
-	return _jobQueue.size(); 
+	int64_t pending = _pendingJobs.load();
+	return pending > 0 ? static_cast<size_t>(pending) : 0;
+}
+
+size_t WorkerPool::getPriorityLevels() const {
+	return _jobQueue.levels();
+}
+
+size_t WorkerPool::getWorkerCount() const {
+	return _workers.size();
 }
 
 bool WorkerPool::isShutdown() const { 
 	return _shutdown; 
 }
+
+bool WorkerPool::isWorkerThread() const {
+	return _currentPool == this;
+}
+
+bool WorkerPool::runPendingJob() {
+	if (_currentPool != this || _shutdown) {
+		return false;
+	}
+	uint64_t seed = 0x9E3779B97F4A7C15ull * (static_cast<uint64_t>(_currentWorker) + 1);
+	QueuedJob queued;
+	if (!_takeJob(_currentWorker, seed, queued)) {
+		return false;
+	}
+	_runJob(queued, *_counters[_currentWorker]);
+	return true;
+}
+
+
+void WorkerPool::enableStats(bool enabled) {
+	_statsEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool WorkerPool::isStatsEnabled() const {
+	return _statsEnabled.load(std::memory_order_relaxed);
+}
+
+// One entry per worker; counters keep their values when stats are turned off
+WorkerPoolStats WorkerPool::getStats() const {
+	WorkerPoolStats stats;
+	stats.workers.resize(_counters.size());
+	for (size_t i = 0; i < _counters.size(); ++i) {
+		_counters[i]->fill(stats.workers[i]);
+	}
+	return stats;
+}
+
+// Updates racing with the reset may survive it
+void WorkerPool::resetStats() {
+	for (auto &counters : _counters) {
+		counters->reset();
+	}
+}
\ No newline at end of file
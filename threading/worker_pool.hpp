@@ -17,9 +17,21 @@
 # include <functional>
 # include <atomic>
 # include <memory>
+# include <limits>
+# include <mutex>
+# include <condition_variable>
+# include <cstdint>
+# include <tuple>
+# include <type_traits>
 
+# include "../data_structures/concurrent_pool.hpp"
+# include "job.hpp"
 # include "thread.hpp"
 # include "thread_safe_queue.hpp"
+# include "priority_queue.hpp"
+# include "work_stealing_deque.hpp"
+# include "job_future.hpp"
+# include "worker_pool_stats.hpp"
 
 class IJobs {
 	public:
@@ -27,23 +39,100 @@ class IJobs {
 		virtual ~IJobs() = default;
 };
 
+/*
+Fixed set of worker threads with work stealing
+
+Jobs added from a pool job go to that worker's deque, the rest to a prioritized
+injection queue (0 is the most urgent). enableStats() turns on per-worker counters.
+*/
 class WorkerPool {
+	public:
+		static constexpr size_t lowestPriority = std::numeric_limits<size_t>::max();
+
 	private:
+		using Clock = WorkerCounters::Clock;
+
+		// A job and when it was queued (only stamped while stats are on)
+		struct QueuedJob {
+			Job job;
+			Clock::time_point queuedAt;
+		};
+
+		// Preallocated slots for jobs queued on worker deques, and for each injection lane
+		static constexpr size_t _localJobSlotsPerWorker = 256;
+		static constexpr size_t _injectedJobSlotsPerLane = 64;
+
 		std::vector<Thread> _workers;
-		ThreadSafeQueue<std::function<void()>> _jobQueue;
+		std::vector<std::unique_ptr<WorkStealingDeque<QueuedJob*>>> _localQueues;
+		ConcurrentPool<QueuedJob> _localJobs;
+		ConcurrentPriorityQueue<QueuedJob> _jobQueue;
+		// Injection lanes more urgent than the one jobs without a priority use
+		uint64_t _urgentLanes;
 		std::atomic<bool> _shutdown;
+		std::atomic<bool> _statsEnabled;
+		std::vector<std::unique_ptr<WorkerCounters>> _counters;
+
+		// Jobs queued anywhere (signed: a job can be taken just before it is counted)
+		std::atomic<int64_t> _pendingJobs;
+		std::atomic<size_t> _sleepers;
+		std::mutex _idleMutex;
+		std::condition_variable _wakeup;
+
+		// Worker running on the current thread, if any
+		static thread_local WorkerPool *_currentPool;
+		static thread_local size_t _currentWorker;
 
 		void _workerFunction(int workerId);
+		void _runJob(QueuedJob &queued, WorkerCounters &counters);
+		void _enqueue(Job &&job, size_t priority);
+		bool _takeJob(size_t workerId, uint64_t &seed, QueuedJob &queued);
+		bool _takeInjected(QueuedJob &queued);
+		QueuedJob *_storeLocal(QueuedJob &&queued);
+		void _freeLocal(QueuedJob *queued);
+		void _wakeOne();
 
 	public:
-		explicit WorkerPool(size_t numWorkers = std::thread::hardware_concurrency());
+		explicit WorkerPool(size_t numWorkers = std::thread::hardware_concurrency(), size_t priorityLevels = 1);
 		~WorkerPool();
 
-		void addJob(const std::function<void()> & jobToExecute);
-		void addJob(std::unique_ptr<IJobs> job);
+		// Lambdas and std::functions convert to Job without being copied
+		void addJob(Job jobToExecute, size_t priority = lowestPriority);
+		void addJob(std::unique_ptr<IJobs> job, size_t priority = lowestPriority);
+
+		// Runs callable(args...) as a job and returns a future for its result.
+		// Arguments are stored by value; the job and its result share one allocation,
+		// the only one made unless the job has to go through the heap fallback.
+		template<typename TCallable, typename... TArgs>
+		auto submit(TCallable &&callable, TArgs&&... args) {
+			using TResult = std::invoke_result_t<std::decay_t<TCallable>&, std::decay_t<TArgs>&...>;
+
+			auto bound = [callable = std::forward<TCallable>(callable),
+				arguments = std::make_tuple(std::forward<TArgs>(args)...)]() mutable -> TResult {
+				return std::apply(callable, arguments);
+			};
+			using Task = JobTask<TResult, decltype(bound)>;
+
+			auto task = std::make_shared<Task>(std::move(bound));
+			JobFuture<TResult> future(task);
+			_enqueue(typename Task::Runner(std::move(task)), lowestPriority);
+			return future;
+		}
 		void shutdownPool();
+		// Jobs queued and not started yet, in every queue
 		size_t getQueueSize() const;
+		size_t getPriorityLevels() const;
+		size_t getWorkerCount() const;
 		bool isShutdown() const;
+		bool isWorkerThread() const;
+		// Lets a job that waits on other jobs run queued ones meanwhile: from one of
+		// this pool's workers, runs one queued job. False when there was none.
+		bool runPendingJob();
+
+		// Instrumentation, off by default
+		void enableStats(bool enabled = true);
+		bool isStatsEnabled() const;
+		WorkerPoolStats getStats() const;
+		void resetStats();
 };
 
 #endif
\ No newline at end of file
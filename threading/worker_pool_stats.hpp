@@ -0,0 +1,130 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   worker_pool_stats.hpp                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hmunoz-g <hmunoz-g@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:05:37 by hmunoz-g          #+#    #+#             */
+/*   Updated: 2026/10/18 18:05:37 by hmunoz-g         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef WORKER_POOL_STATS_HPP
+# define WORKER_POOL_STATS_HPP
+
+# include <array>
+# include <atomic>
+# include <chrono>
+# include <cstddef>
+# include <cstdint>
+# include <vector>
+
+# include "../data_structures/pool_storage.hpp"
+
+// Point-in-time copy of one worker's counters, see WorkerPool::getStats()
+struct WorkerStatsSnapshot {
+	static constexpr size_t histogramBuckets = 32;
+
+	uint64_t jobsExecuted = 0;
+	uint64_t jobsFailed = 0;
+	// Time spent asleep waiting for work, added when the worker wakes up
+	uint64_t idleNanoseconds = 0;
+	// Bucket i counts jobs that waited in a queue / ran for [2^i, 2^(i+1)) nanoseconds
+	std::array<uint64_t, histogramBuckets> queueWait = {};
+	std::array<uint64_t, histogramBuckets> executionTime = {};
+
+	void merge(const WorkerStatsSnapshot &other) {
+		jobsExecuted += other.jobsExecuted;
+		jobsFailed += other.jobsFailed;
+		idleNanoseconds += other.idleNanoseconds;
+		for (size_t i = 0; i < histogramBuckets; ++i) {
+			queueWait[i] += other.queueWait[i];
+			executionTime[i] += other.executionTime[i];
+		}
+	}
+};
+
+struct WorkerPoolStats {
+	std::vector<WorkerStatsSnapshot> workers;
+
+	WorkerStatsSnapshot total() const {
+		WorkerStatsSnapshot sum;
+		for (const WorkerStatsSnapshot &worker : workers) {
+			sum.merge(worker);
+		}
+		return sum;
+	}
+};
+
+/*
+Counters of one worker. Only that worker writes them (relaxed atomics on a
+cache line of their own), any thread may read them.
+*/
+class alignas(cacheLineSize) WorkerCounters {
+	public:
+		using Clock = std::chrono::steady_clock;
+
+	private:
+		using Histogram = std::array<std::atomic<uint64_t>, WorkerStatsSnapshot::histogramBuckets>;
+
+		std::atomic<uint64_t> _jobsExecuted;
+		std::atomic<uint64_t> _jobsFailed;
+		std::atomic<uint64_t> _idleNanoseconds;
+		Histogram _queueWait;
+		Histogram _executionTime;
+
+		static uint64_t _nanoseconds(Clock::duration elapsed) {
+			int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+			return (ns > 0 ? static_cast<uint64_t>(ns) : 0);
+		}
+
+		static void _record(Histogram &histogram, Clock::duration elapsed) {
+			uint64_t ns = _nanoseconds(elapsed);
+			size_t bucket = 0;
+			while (ns > 1 && bucket + 1 < histogram.size()) {
+				ns >>= 1;
+				bucket++;
+			}
+			histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+		}
+
+	public:
+		WorkerCounters() { reset(); }
+
+		void recordIdle(Clock::duration elapsed) {
+			_idleNanoseconds.fetch_add(_nanoseconds(elapsed), std::memory_order_relaxed);
+		}
+
+		void recordQueueWait(Clock::duration elapsed) { _record(_queueWait, elapsed); }
+
+		void recordJob(Clock::duration elapsed, bool failed) {
+			_jobsExecuted.fetch_add(1, std::memory_order_relaxed);
+			if (failed) {
+				_jobsFailed.fetch_add(1, std::memory_order_relaxed);
+			}
+			_record(_executionTime, elapsed);
+		}
+
+		void fill(WorkerStatsSnapshot &snapshot) const {
+			snapshot.jobsExecuted = _jobsExecuted.load(std::memory_order_relaxed);
+			snapshot.jobsFailed = _jobsFailed.load(std::memory_order_relaxed);
+			snapshot.idleNanoseconds = _idleNanoseconds.load(std::memory_order_relaxed);
+			for (size_t i = 0; i < WorkerStatsSnapshot::histogramBuckets; ++i) {
+				snapshot.queueWait[i] = _queueWait[i].load(std::memory_order_relaxed);
+				snapshot.executionTime[i] = _executionTime[i].load(std::memory_order_relaxed);
+			}
+		}
+
+		void reset() {
+			_jobsExecuted.store(0, std::memory_order_relaxed);
+			_jobsFailed.store(0, std::memory_order_relaxed);
+			_idleNanoseconds.store(0, std::memory_order_relaxed);
+			for (size_t i = 0; i < WorkerStatsSnapshot::histogramBuckets; ++i) {
+				_queueWait[i].store(0, std::memory_order_relaxed);
+				_executionTime[i].store(0, std::memory_order_relaxed);
+			}
+		}
+};
+
+#endif
\ No newline at end of file